@@ -0,0 +1,80 @@
+#include <chrono>
+#include <filesystem>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include "builders/OutputSink.hpp"
+#include "builders/UringSink.hpp"
+
+using namespace TemplateBuilder;
+
+// Writes a generated project tree of many small files through each output
+// backend and reports files per second.
+//
+// Usage: bench_write [files] [bytes per file] [files per directory] [output dir]
+
+namespace {
+
+double timeRun(const std::filesystem::path& root, size_t files, const std::string& content, size_t perDirectory,
+               const std::function<void(OutputSink&)>& finish, OutputSink& sink) {
+    const auto start = std::chrono::steady_clock::now();
+    for (size_t i = 0; i < files; ++i) {
+        const size_t directory = i / perDirectory;
+        sink.writeFile("module" + std::to_string(directory % 16) + "/pkg" + std::to_string(directory) +
+                           "/file" + std::to_string(i) + ".txt",
+                       content);
+    }
+    finish(sink);
+    const double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    std::filesystem::remove_all(root);
+    return seconds;
+}
+
+void report(const std::string& name, size_t files, double seconds) {
+    std::cout << std::left << std::setw(16) << name << std::right << std::setw(12) << std::fixed
+              << std::setprecision(0) << (files / seconds) << " files/s" << std::setw(12) << std::setprecision(2)
+              << seconds * 1000.0 << " ms" << std::endl;
+}
+
+} // namespace
+
+int main(int argc, char* argv[]) {
+    const size_t files = argc > 1 ? std::stoul(argv[1]) : 20000;
+    const size_t bytes = argc > 2 ? std::stoul(argv[2]) : 256;
+    const size_t perDirectory = argc > 3 ? std::max<size_t>(1, std::stoul(argv[3])) : 50;
+    const std::filesystem::path base = argc > 4 ? std::filesystem::path(argv[4])
+                                                : std::filesystem::temp_directory_path() / "bench_write";
+    const std::string content(bytes, 'x');
+    const int rounds = 3;
+
+    std::cout << files << " files of " << bytes << " bytes, " << perDirectory << " per directory, best of "
+              << rounds << std::endl;
+    if (!UringSink::isSupported()) {
+        std::cout << "io_uring unavailable: UringSink measures the POSIX fallback" << std::endl;
+    }
+
+    double posix = 0.0;
+    double uring = 0.0;
+    for (int round = 0; round < rounds; ++round) {
+        const std::filesystem::path posixRoot = base / "posix";
+        std::filesystem::remove_all(posixRoot);
+        DirectorySink directorySink(posixRoot);
+        const double posixSeconds = timeRun(posixRoot, files, content, perDirectory, [](OutputSink&) {}, directorySink);
+
+        const std::filesystem::path uringRoot = base / "uring";
+        std::filesystem::remove_all(uringRoot);
+        UringSink uringSink(uringRoot);
+        const double uringSeconds = timeRun(uringRoot, files, content, perDirectory,
+                                            [](OutputSink& sink) { static_cast<UringSink&>(sink).flush(); }, uringSink);
+
+        posix = round == 0 ? posixSeconds : std::min(posix, posixSeconds);
+        uring = round == 0 ? uringSeconds : std::min(uring, uringSeconds);
+    }
+    std::filesystem::remove_all(base);
+
+    report("DirectorySink", files, posix);
+    report("UringSink", files, uring);
+    std::cout << "Speedup: " << std::setprecision(2) << posix / uring << "x" << std::endl;
+    return 0;
+}
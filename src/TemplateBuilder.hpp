@@ -0,0 +1,9 @@
+#pragma once
+
+// Public entry point of the templatebuilder library
+#include "builders/DurableSink.hpp"
+#include "builders/OutputSink.hpp"
+#include "builders/UringSink.hpp"
+#include "services/BatchRunner.hpp"
+#include "services/Template.hpp"
+#include "services/TemplateCache.hpp"
@@ -0,0 +1,228 @@
+#include "builders/DurableSink.hpp"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <mutex>
+#include <stdexcept>
+#include <system_error>
+#include <thread>
+#include <vector>
+
+#ifndef _WIN32
+#include <fcntl.h>
+#include <unistd.h>
+#include <cerrno>
+#endif
+
+namespace TemplateBuilder {
+
+namespace {
+
+std::filesystem::path normalizeTarget(const std::filesystem::path& target) {
+    std::filesystem::path normalized = std::filesystem::absolute(target).lexically_normal();
+    if (normalized.filename().empty()) {
+        normalized = normalized.parent_path();
+    }
+    return normalized;
+}
+
+std::filesystem::path siblingOf(const std::filesystem::path& target, const std::string& suffix) {
+    return target.parent_path() / ("." + target.filename().string() + suffix);
+}
+
+double millisecondsSince(std::chrono::steady_clock::time_point start) {
+    return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+}
+
+#ifndef _WIN32
+
+void fsyncPath(const std::filesystem::path& path) {
+    const int fd = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+    if (fd < 0) {
+        throw std::system_error(errno, std::generic_category(), "Unable to open for sync: " + path.string());
+    }
+    const int result = ::fsync(fd);
+    const int error = errno;
+    ::close(fd);
+    if (result != 0) {
+        throw std::system_error(error, std::generic_category(), "Unable to sync: " + path.string());
+    }
+}
+
+// Flushes every entry of the tree with a small pool of threads so the
+// device sees the fsyncs as one batch instead of a serial round trip each
+void parallelFsync(const std::filesystem::path& root) {
+    std::vector<std::filesystem::path> entries = {root};
+    for (const auto& entry : std::filesystem::recursive_directory_iterator(root)) {
+        entries.push_back(entry.path());
+    }
+
+    const size_t threadCount = std::min<size_t>(entries.size(), std::max(1u, std::min(8u, std::thread::hardware_concurrency())));
+    std::atomic<size_t> next{0};
+    std::mutex errorMutex;
+    std::string firstError;
+
+    std::vector<std::thread> threads;
+    for (size_t t = 0; t < threadCount; ++t) {
+        threads.emplace_back([&]() {
+            for (size_t i = next++; i < entries.size(); i = next++) {
+                try {
+                    fsyncPath(entries[i]);
+                } catch (const std::exception& e) {
+                    std::lock_guard<std::mutex> lock(errorMutex);
+                    if (firstError.empty()) {
+                        firstError = e.what();
+                    }
+                }
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    if (!firstError.empty()) {
+        throw std::runtime_error(firstError);
+    }
+}
+
+#endif
+
+} // namespace
+
+DurableSink::DurableSink(const std::filesystem::path& target)
+    : m_target(normalizeTarget(target)), m_staging(siblingOf(m_target, ".staging")) {
+#ifdef _WIN32
+    throw std::runtime_error("Durable output is not supported on this platform.");
+#else
+    recover();
+
+    // Leftover from an interrupted run; the target itself was never touched
+    std::filesystem::remove_all(getStaging());
+    std::filesystem::create_directories(getStaging());
+#endif
+}
+
+DurableSink::~DurableSink() {
+    if (!m_committed) {
+        std::error_code error;
+        std::filesystem::remove_all(getStaging(), error);
+    }
+}
+
+void DurableSink::writeFile(const std::string& path, const std::string& content) {
+    m_staging.writeFile(path, content);
+}
+
+void DurableSink::createFolder(const std::string& path) {
+    m_staging.createFolder(path);
+}
+
+DurableStats DurableSink::commit() {
+    if (m_committed) {
+        throw std::runtime_error("Output already committed: " + m_target.string());
+    }
+
+    DurableStats stats;
+    for (const auto& entry : std::filesystem::recursive_directory_iterator(getStaging())) {
+        if (entry.is_regular_file()) {
+            ++stats.files;
+        }
+    }
+
+    auto start = std::chrono::steady_clock::now();
+    syncStaging();
+    stats.syncMilliseconds = millisecondsSince(start);
+
+    start = std::chrono::steady_clock::now();
+    stats.exchanged = publish();
+    m_committed = true;
+    stats.publishMilliseconds = millisecondsSince(start);
+
+    return stats;
+}
+
+void DurableSink::recover() {
+    // A run interrupted between the two renames of the fallback publish left
+    // the old tree aside and no target: put it back. With the target in
+    // place the old tree is just a leftover of a finished publish.
+    const std::filesystem::path previous = siblingOf(m_target, ".previous");
+    if (!std::filesystem::exists(previous)) {
+        return;
+    }
+
+    if (std::filesystem::exists(m_target)) {
+        std::filesystem::remove_all(previous);
+    } else {
+        std::filesystem::rename(previous, m_target);
+#ifndef _WIN32
+        fsyncPath(m_target.parent_path());
+#endif
+    }
+}
+
+void DurableSink::syncStaging() {
+#ifdef __linux__
+    // One syncfs flushes the whole filesystem, covering every staged file
+    // and directory without opening them individually
+    const int fd = ::open(getStaging().c_str(), O_RDONLY | O_DIRECTORY | O_CLOEXEC);
+    if (fd >= 0) {
+        const int result = ::syncfs(fd);
+        ::close(fd);
+        if (result == 0) {
+            return;
+        }
+    }
+#endif
+#ifndef _WIN32
+    parallelFsync(getStaging());
+#endif
+}
+
+bool DurableSink::publish() {
+    const std::filesystem::path parent = m_target.parent_path();
+    bool exchanged = false;
+    std::filesystem::path previous;
+
+    if (!std::filesystem::exists(m_target)) {
+        std::filesystem::rename(getStaging(), m_target);
+    } else {
+#if defined(__linux__) && defined(RENAME_EXCHANGE)
+        // Atomically swap the trees; the old one ends up at the staging path
+        if (::renameat2(AT_FDCWD, getStaging().c_str(), AT_FDCWD, m_target.c_str(), RENAME_EXCHANGE) == 0) {
+            exchanged = true;
+            previous = getStaging();
+        }
+#endif
+        if (!exchanged) {
+            // Filesystem without RENAME_EXCHANGE: move the old tree aside
+            // first. A crash between the renames leaves no target; the next
+            // DurableSink for it restores the old tree in recover().
+            previous = siblingOf(m_target, ".previous");
+            std::filesystem::remove_all(previous);
+            std::filesystem::rename(m_target, previous);
+            try {
+                std::filesystem::rename(getStaging(), m_target);
+            } catch (const std::filesystem::filesystem_error&) {
+                // Put the old tree back so a failed publish leaves the target as it was
+                std::error_code restoreError;
+                std::filesystem::rename(previous, m_target, restoreError);
+                throw;
+            }
+        }
+    }
+
+#ifndef _WIN32
+    // Persist the directory entry change itself
+    fsyncPath(parent);
+#endif
+
+    if (!previous.empty()) {
+        std::filesystem::remove_all(previous);
+    }
+
+    return exchanged;
+}
+
+} // namespace TemplateBuilder
@@ -0,0 +1,48 @@
+#pragma once
+
+#include <filesystem>
+#include <string>
+#include "builders/OutputSink.hpp"
+
+namespace TemplateBuilder {
+
+struct DurableStats {
+    size_t files = 0;
+    double syncMilliseconds = 0.0;     // Flushing the staged tree to stable storage
+    double publishMilliseconds = 0.0;  // Swapping it into place and syncing the parent
+    bool exchanged = false;            // Replaced an existing tree with RENAME_EXCHANGE
+};
+
+// All-or-nothing output: files are rendered into a staging directory next to
+// the target, flushed in one batch and published with a single rename. If
+// commit() is never reached the target is left untouched. Not available on
+// Windows, where the staged tree cannot be synced; construction throws.
+class DurableSink : public OutputSink {
+public:
+    explicit DurableSink(const std::filesystem::path& target);
+    ~DurableSink() override;
+
+    DurableSink(const DurableSink&) = delete;
+    DurableSink& operator=(const DurableSink&) = delete;
+
+    void writeFile(const std::string& path, const std::string& content) override;
+    void createFolder(const std::string& path) override;
+
+    // Makes the staged tree durable and atomically replaces the target
+    DurableStats commit();
+
+    // Getters
+    [[nodiscard]] const std::filesystem::path& getTarget() const noexcept { return m_target; }
+    [[nodiscard]] const std::filesystem::path& getStaging() const noexcept { return m_staging.getRoot(); }
+
+private:
+    void recover();
+    void syncStaging();
+    bool publish();
+
+    std::filesystem::path m_target;
+    DirectorySink m_staging;
+    bool m_committed = false;
+};
+
+} // namespace TemplateBuilder
@@ -0,0 +1,96 @@
+#include "builders/EachExpander.hpp"
+#include <algorithm>
+#include <cctype>
+#include <sstream>
+#include <stdexcept>
+
+namespace TemplateBuilder {
+
+namespace {
+
+bool sameText(const std::string& left, const std::string& right) {
+    return left.size() == right.size() &&
+           std::equal(left.begin(), left.end(), right.begin(), [](unsigned char a, unsigned char b) {
+               return std::tolower(a) == std::tolower(b);
+           });
+}
+
+} // namespace
+
+void EachExpander::expand(const FileData& entry, const std::vector<Variable*>* variables, const Visitor& visit) const {
+    if (!entry.hasEach()) {
+        visit(entry.getPath(), variables);
+        return;
+    }
+
+    const Variable* source = findSource(entry, variables);
+    if (!source->hasValue()) {
+        return;
+    }
+
+    // Bindings go first so they shadow template variables with the same name;
+    // they are reused for every element instead of allocated per output
+    const std::string& name = entry.getEachAs();
+    Variable item(name, VariableType::vtString);
+    Variable key(name + ".key", VariableType::vtString);
+    Variable value(name + ".value", VariableType::vtString);
+
+    std::vector<Variable*> scope;
+    scope.reserve(variables->size() + 2);
+
+    if (source->isMap()) {
+        scope.push_back(&key);
+        scope.push_back(&value);
+        scope.insert(scope.end(), variables->begin(), variables->end());
+        for (const auto& [mapKey, mapValue] : source->getMap()) {
+            key.setValue(mapKey);
+            value.setValue(mapValue);
+            visit(m_promptBuilder.getContent(entry.getPath(), &scope), &scope);
+        }
+        return;
+    }
+
+    scope.push_back(&item);
+    scope.insert(scope.end(), variables->begin(), variables->end());
+    const auto visitItems = [&](const VariableList& items) {
+        for (const auto& element : items) {
+            item.setValue(element);
+            visit(m_promptBuilder.getContent(entry.getPath(), &scope), &scope);
+        }
+    };
+
+    if (source->isList()) {
+        visitItems(source->getList());
+    } else {
+        // Strings fan out one output per non-empty line (e.g. ArrayList answers)
+        visitItems(splitLines(source->getValue()));
+    }
+}
+
+const Variable* EachExpander::findSource(const FileData& entry, const std::vector<Variable*>* variables) {
+    if (variables != nullptr) {
+        for (const auto* variable : *variables) {
+            if (variable != nullptr && sameText(variable->getName(), entry.getEach())) {
+                return variable;
+            }
+        }
+    }
+    throw std::runtime_error("Variable \"" + entry.getEach() + "\" used by each: not found for " + entry.getPath() + ".");
+}
+
+VariableList EachExpander::splitLines(const std::string& text) {
+    VariableList lines;
+    std::stringstream stream(text);
+    std::string line;
+    while (std::getline(stream, line)) {
+        if (!line.empty() && line.back() == '\r') {
+            line.pop_back();
+        }
+        if (line.find_first_not_of(" \t") != std::string::npos) {
+            lines.push_back(line);
+        }
+    }
+    return lines;
+}
+
+} // namespace TemplateBuilder
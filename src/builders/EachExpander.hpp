@@ -0,0 +1,32 @@
+#pragma once
+
+#include <functional>
+#include <string>
+#include <vector>
+#include "builders/PromptBuilder.hpp"
+#include "types/FileType.hpp"
+#include "types/VariableType.hpp"
+
+namespace TemplateBuilder {
+
+// Expands a files/folders entry with an `each:` clause into one output per
+// element. Outputs are produced one at a time, so N elements never become N
+// FileData objects. Bindings for the current element are visible to the path
+// and content templates:
+//   list / multi-line string: {{<as>}}
+//   map:                      {{<as>.key}} and {{<as>.value}}
+class EachExpander {
+public:
+    using Visitor = std::function<void(const std::string& path, const std::vector<Variable*>* variables)>;
+
+    // Calls visit once per output; entries without `each:` produce a single output
+    void expand(const FileData& entry, const std::vector<Variable*>* variables, const Visitor& visit) const;
+
+private:
+    [[nodiscard]] static const Variable* findSource(const FileData& entry, const std::vector<Variable*>* variables);
+    [[nodiscard]] static VariableList splitLines(const std::string& text);
+
+    PromptBuilder m_promptBuilder;  // Path rendering only, never prompts
+};
+
+} // namespace TemplateBuilder
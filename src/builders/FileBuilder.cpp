@@ -0,0 +1,55 @@
+#include "builders/FileBuilder.hpp"
+#include <filesystem>
+#include <fstream>
+#include <stdexcept>
+
+namespace TemplateBuilder {
+
+FileBuilder::FileBuilder(const PromptBuilder& promptBuilder)
+    : m_promptBuilder(promptBuilder) {
+}
+
+void FileBuilder::build(const FileData& file) {
+    if (file.hasPrompt()) {
+        m_promptBuilder.collect(*file.getPrompt());
+    }
+    m_eachExpander.expand(file, file.getVariables(), [&](const std::string& path, const std::vector<Variable*>* variables) {
+        write(path, render(file, variables));
+    });
+}
+
+std::string FileBuilder::render(const FileData& file) const {
+    return render(file, file.getVariables());
+}
+
+std::string FileBuilder::render(const FileData& file, const std::vector<Variable*>* variables) const {
+    if (file.hasPrompt()) {
+        return m_promptBuilder.getContent(file.getPrompt()->getResult(), variables);
+    }
+    return m_promptBuilder.getContent(file.getContent(), variables);
+}
+
+void FileBuilder::write(const std::string& path, const std::string& content) {
+    if (path.empty()) {
+        throw std::runtime_error("File path cannot be empty.");
+    }
+
+    writeFile(std::filesystem::current_path() / path, content);
+}
+
+void FileBuilder::writeFile(const std::filesystem::path& fullPath, const std::string& content,
+                            bool createDirectories) {
+    const std::filesystem::path directory = fullPath.parent_path();
+
+    if (createDirectories && !directory.empty() && !std::filesystem::exists(directory)) {
+        std::filesystem::create_directories(directory);
+    }
+
+    std::ofstream stream(fullPath, std::ios::binary | std::ios::trunc);
+    if (!stream) {
+        throw std::runtime_error("Unable to write file: " + fullPath.string());
+    }
+    stream << content;
+}
+
+} // namespace TemplateBuilder
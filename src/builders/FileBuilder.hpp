@@ -0,0 +1,42 @@
+#pragma once
+
+#include <filesystem>
+#include <string>
+#include <vector>
+#include "builders/EachExpander.hpp"
+#include "builders/PromptBuilder.hpp"
+#include "types/FileType.hpp"
+
+namespace TemplateBuilder {
+
+class FileBuilder {
+public:
+    // Constructors
+    FileBuilder() = default;
+    explicit FileBuilder(const PromptBuilder& promptBuilder);
+
+    // Runs the file prompt (if any) and writes the rendered content,
+    // one file per element for entries with an `each:` clause
+    void build(const FileData& file);
+
+    // Renders the file content from the current variable values
+    [[nodiscard]] std::string render(const FileData& file) const;
+
+    // Renders against a caller-owned variable set instead of the file's own
+    [[nodiscard]] std::string render(const FileData& file, const std::vector<Variable*>* variables) const;
+
+    // Writes already rendered content, creating parent directories as needed
+    static void write(const std::string& path, const std::string& content);
+    static void writeFile(const std::filesystem::path& fullPath, const std::string& content,
+                          bool createDirectories = true);
+
+    // Getters
+    [[nodiscard]] PromptBuilder& getPromptBuilder() noexcept { return m_promptBuilder; }
+    [[nodiscard]] const EachExpander& getEachExpander() const noexcept { return m_eachExpander; }
+
+private:
+    PromptBuilder m_promptBuilder;
+    EachExpander m_eachExpander;
+};
+
+} // namespace TemplateBuilder
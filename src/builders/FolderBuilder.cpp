@@ -0,0 +1,28 @@
+#include "builders/FolderBuilder.hpp"
+#include <stdexcept>
+
+namespace TemplateBuilder {
+
+void FolderBuilder::build(const FileData& folder) const {
+    m_eachExpander.expand(folder, folder.getVariables(), [](const std::string& path, const std::vector<Variable*>*) {
+        if (path.empty()) {
+            throw std::runtime_error("Folder path cannot be empty.");
+        }
+
+        const std::filesystem::path directory = directoryOf(std::filesystem::current_path() / path, path);
+
+        // Create the directory structure (only creates if it doesn't exist)
+        if (!directory.empty() && !std::filesystem::exists(directory)) {
+            std::filesystem::create_directories(directory);
+        }
+    });
+}
+
+std::filesystem::path FolderBuilder::directoryOf(const std::filesystem::path& fullPath, const std::string& path) {
+    if (!path.empty() && (path.back() == '/' || path.back() == '\\')) {
+        return fullPath;
+    }
+    return fullPath.parent_path();
+}
+
+} // namespace TemplateBuilder
@@ -0,0 +1,23 @@
+#pragma once
+
+#include <filesystem>
+#include <string>
+#include "builders/EachExpander.hpp"
+#include "types/FileType.hpp"
+
+namespace TemplateBuilder {
+
+class FolderBuilder {
+public:
+    // Creates the folder, or one folder per element for `each:` entries
+    void build(const FileData& folder) const;
+
+    // Directory a folder entry creates: the full path when the YAML path ends
+    // with a separator, otherwise its parent (same logic as FileBuilder)
+    [[nodiscard]] static std::filesystem::path directoryOf(const std::filesystem::path& fullPath, const std::string& path);
+
+private:
+    EachExpander m_eachExpander;
+};
+
+} // namespace TemplateBuilder
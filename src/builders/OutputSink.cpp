@@ -0,0 +1,95 @@
+#include "builders/OutputSink.hpp"
+#include "builders/FileBuilder.hpp"
+#include "builders/FolderBuilder.hpp"
+#include <stdexcept>
+
+namespace TemplateBuilder {
+
+// DirectoryCache implementation
+void DirectoryCache::ensure(const std::filesystem::path& directory) {
+    if (directory.empty()) {
+        return;
+    }
+
+    const std::string key = keyOf(directory);
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        if (m_created.count(key) != 0) {
+            return;
+        }
+    }
+
+    // Created outside the lock; create_directories tolerates concurrent creators
+    std::filesystem::create_directories(directory);
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_created.insert(key);
+}
+
+bool DirectoryCache::contains(const std::filesystem::path& directory) const {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_created.count(keyOf(directory)) != 0;
+}
+
+void DirectoryCache::add(const std::filesystem::path& directory) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_created.insert(keyOf(directory));
+}
+
+std::string DirectoryCache::keyOf(const std::filesystem::path& directory) {
+    // "a/b/" and "a/b" name the same directory
+    std::filesystem::path normalized = directory.lexically_normal();
+    if (normalized.filename().empty() && normalized.has_relative_path()) {
+        normalized = normalized.parent_path();
+    }
+    return normalized.string();
+}
+
+// DirectorySink implementation
+DirectorySink::DirectorySink(const std::filesystem::path& root)
+    : DirectorySink(root, std::make_shared<DirectoryCache>()) {
+}
+
+DirectorySink::DirectorySink(const std::filesystem::path& root, std::shared_ptr<DirectoryCache> directories)
+    : m_root(std::filesystem::absolute(root)), m_directories(std::move(directories)) {
+}
+
+void DirectorySink::writeFile(const std::string& path, const std::string& content) {
+    if (path.empty()) {
+        throw std::runtime_error("File path cannot be empty.");
+    }
+    const std::filesystem::path fullPath = m_root / path;
+    m_directories->ensure(fullPath.parent_path());
+    FileBuilder::writeFile(fullPath, content, false);
+    ++m_filesWritten;
+}
+
+void DirectorySink::createFolder(const std::string& path) {
+    if (path.empty()) {
+        throw std::runtime_error("Folder path cannot be empty.");
+    }
+    m_directories->ensure(FolderBuilder::directoryOf(m_root / path, path));
+}
+
+// MemorySink implementation
+void MemorySink::writeFile(const std::string& path, const std::string& content) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_files[path] = content;
+}
+
+void MemorySink::createFolder(const std::string& path) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_folders.insert(path);
+}
+
+std::map<std::string, std::string> MemorySink::getFiles() const {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_files;
+}
+
+std::set<std::string> MemorySink::getFolders() const {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_folders;
+}
+
+} // namespace TemplateBuilder
@@ -0,0 +1,74 @@
+#pragma once
+
+#include <atomic>
+#include <filesystem>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <set>
+#include <string>
+#include <unordered_set>
+
+namespace TemplateBuilder {
+
+// Destination for rendered template output. Implementations must be safe to
+// call from several renders at once when shared between threads.
+class OutputSink {
+public:
+    virtual ~OutputSink() = default;
+
+    virtual void writeFile(const std::string& path, const std::string& content) = 0;
+    virtual void createFolder(const std::string& path) = 0;
+};
+
+// Directories known to exist. Sinks that share one skip the stat/mkdir
+// round trip for every file after the first in a directory.
+class DirectoryCache {
+public:
+    void ensure(const std::filesystem::path& directory);
+
+    // For sinks that create directories themselves
+    [[nodiscard]] bool contains(const std::filesystem::path& directory) const;
+    void add(const std::filesystem::path& directory);
+
+private:
+    [[nodiscard]] static std::string keyOf(const std::filesystem::path& directory);
+
+    mutable std::mutex m_mutex;
+    std::unordered_set<std::string> m_created;
+};
+
+// Writes output below a root directory (independent of the working directory)
+class DirectorySink : public OutputSink {
+public:
+    explicit DirectorySink(const std::filesystem::path& root);
+    DirectorySink(const std::filesystem::path& root, std::shared_ptr<DirectoryCache> directories);
+
+    void writeFile(const std::string& path, const std::string& content) override;
+    void createFolder(const std::string& path) override;
+
+    [[nodiscard]] const std::filesystem::path& getRoot() const noexcept { return m_root; }
+    [[nodiscard]] size_t getFilesWritten() const noexcept { return m_filesWritten; }
+
+private:
+    std::filesystem::path m_root;
+    std::shared_ptr<DirectoryCache> m_directories;
+    std::atomic<size_t> m_filesWritten{0};
+};
+
+// Collects output in memory, keyed by template path
+class MemorySink : public OutputSink {
+public:
+    void writeFile(const std::string& path, const std::string& content) override;
+    void createFolder(const std::string& path) override;
+
+    [[nodiscard]] std::map<std::string, std::string> getFiles() const;
+    [[nodiscard]] std::set<std::string> getFolders() const;
+
+private:
+    mutable std::mutex m_mutex;
+    std::map<std::string, std::string> m_files;
+    std::set<std::string> m_folders;
+};
+
+} // namespace TemplateBuilder
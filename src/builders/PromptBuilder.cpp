@@ -0,0 +1,389 @@
+#include "builders/PromptBuilder.hpp"
+#include <algorithm>
+#include <cctype>
+#include <regex>
+#include <sstream>
+#include <stdexcept>
+
+namespace TemplateBuilder {
+
+namespace {
+
+std::string trim(const std::string& value) {
+    const auto first = value.find_first_not_of(" \t\r\n");
+    if (first == std::string::npos) {
+        return "";
+    }
+    const auto last = value.find_last_not_of(" \t\r\n");
+    return value.substr(first, last - first + 1);
+}
+
+std::string toLower(std::string value) {
+    std::transform(value.begin(), value.end(), value.begin(),
+                   [](unsigned char c) { return static_cast<char>(std::tolower(c)); });
+    return value;
+}
+
+std::string toUpper(std::string value) {
+    std::transform(value.begin(), value.end(), value.begin(),
+                   [](unsigned char c) { return static_cast<char>(std::toupper(c)); });
+    return value;
+}
+
+std::string replaceAll(std::string value, const std::string& from, const std::string& to) {
+    if (from.empty()) {
+        return value;
+    }
+    size_t pos = 0;
+    while ((pos = value.find(from, pos)) != std::string::npos) {
+        value.replace(pos, from.size(), to);
+        pos += to.size();
+    }
+    return value;
+}
+
+} // namespace
+
+PromptBuilder::PromptBuilder()
+    : m_input(std::cin), m_output(std::cout) {
+}
+
+PromptBuilder::PromptBuilder(std::istream& input, std::ostream& output)
+    : m_input(input), m_output(output) {
+}
+
+std::string PromptBuilder::build(Prompt* prompt, const std::vector<Variable*>* variables) {
+    if (prompt == nullptr) {
+        return "";
+    }
+
+    collect(*prompt);
+    return getContent(prompt->getResult(), variables);
+}
+
+void PromptBuilder::collect(Prompt& prompt) {
+    for (auto& promptInput : prompt.getInputs()) {
+        collectInput(*promptInput);
+    }
+}
+
+void PromptBuilder::collectInput(PromptInput& promptInput) {
+    if (promptInput.getVariable() == nullptr) {
+        throw std::runtime_error("Variable is null in PromptInput.");
+    }
+
+    switch (promptInput.getType()) {
+        case PromptType::ptInputString:
+            getInputString(promptInput);
+            break;
+        case PromptType::ptChecklist:
+            getChecklist(promptInput);
+            break;
+        case PromptType::ptArrayList:
+            getArrayList(promptInput);
+            break;
+    }
+}
+
+void PromptBuilder::getInputString(PromptInput& promptInput) {
+    std::string userInput;
+    m_output << promptInput.getInput();
+    std::getline(m_input, userInput);
+    promptInput.getVariable()->setValue(userInput);
+}
+
+void PromptBuilder::getChecklist(PromptInput& promptInput) {
+    const auto& options = promptInput.getOptions();
+    if (options.empty()) {
+        throw std::runtime_error("No options available for checklist input.");
+    }
+
+    // The Pascal version drove this with raw console key events; a numbered
+    // selection keeps the prompt portable across terminals.
+    m_output << std::endl << promptInput.getInput() << std::endl << std::endl;
+    for (size_t i = 0; i < options.size(); ++i) {
+        m_output << "  [" << (i + 1) << "] " << options[i]->getName() << std::endl;
+    }
+    m_output << "Enter the numbers of the options to select, separated by commas: ";
+
+    std::string userInput;
+    std::getline(m_input, userInput);
+
+    std::vector<bool> selected(options.size(), false);
+    std::stringstream stream(userInput);
+    std::string item;
+    while (std::getline(stream, item, ',')) {
+        item = trim(item);
+        if (item.empty()) {
+            continue;
+        }
+        try {
+            const size_t index = std::stoul(item);
+            if (index >= 1 && index <= options.size()) {
+                selected[index - 1] = true;
+            }
+        } catch (const std::exception&) {
+            // Ignore entries that are not numbers
+        }
+    }
+
+    std::string selectedValues;
+    for (size_t i = 0; i < options.size(); ++i) {
+        if (selected[i]) {
+            if (!selectedValues.empty()) {
+                selectedValues += '\n';
+            }
+            selectedValues += options[i]->getValue();
+        }
+    }
+
+    m_output << std::endl;
+    promptInput.getVariable()->setValue(selectedValues);
+}
+
+void PromptBuilder::getArrayList(PromptInput& promptInput) {
+    m_output << std::endl << promptInput.getInput() << std::endl;
+    m_output << "Enter each option and press Enter. Leave empty and press Enter to finish:" << std::endl << std::endl;
+
+    std::string lines;
+    std::string userInput;
+    while (true) {
+        m_output << "> ";
+        if (!std::getline(m_input, userInput) || trim(userInput).empty()) {
+            break;
+        }
+        lines += userInput + '\n';
+    }
+
+    promptInput.getVariable()->setValue(lines);
+    m_output << std::endl;
+}
+
+std::string PromptBuilder::getContent(const std::string& content, const std::vector<Variable*>* variables) const {
+    if (variables == nullptr) {
+        return content;
+    }
+
+    std::string result = content;
+
+    // First, process special pattern {{"prefix" | variableName}}
+    static const std::regex prefixPattern(R"re(\{\{"([^"]+)"\s*\|\s*(\w+)\}\})re");
+    std::string prefixed;
+    auto searchStart = result.cbegin();
+    std::smatch match;
+    while (std::regex_search(searchStart, result.cend(), match, prefixPattern)) {
+        const std::string prefix = match[1].str();
+        const std::string value = resolveVariableValue(*variables, match[2].str());
+
+        std::string processedValue;
+        std::stringstream lines(value);
+        std::string line;
+        while (std::getline(lines, line)) {
+            if (!line.empty() && line.back() == '\r') {
+                line.pop_back();
+            }
+            if (trim(line).empty()) {
+                continue;
+            }
+            if (!processedValue.empty()) {
+                processedValue += '\n';
+            }
+            processedValue += prefix + line;
+        }
+
+        prefixed.append(searchStart, match[0].first);
+        prefixed += processedValue;
+        searchStart = match[0].second;
+    }
+    prefixed.append(searchStart, result.cend());
+    result = std::move(prefixed);
+
+    // Second, process function expressions {{upper(variable)}}, {{replace(" ", "_", variable)}}, etc.
+    // Restart the scan after every replacement so nested results are handled
+    const int maxIterations = 100;  // Safety limit
+    bool processed = false;
+    int iteration = 0;
+    do {
+        processed = false;
+        for (size_t i = 0; i + 2 < result.size() && !processed; ++i) {
+            if (result[i] != '{' || result[i + 1] != '{') {
+                continue;
+            }
+
+            size_t funcStart = 0;
+            bool foundFunc = false;
+            int parenDepth = 0;
+            bool inQuotes = false;
+            char quoteChar = '\0';
+
+            for (size_t j = i + 2; j + 1 < result.size(); ++j) {
+                const char current = result[j];
+                if (inQuotes) {
+                    if (current == quoteChar) {
+                        if (result[j + 1] == quoteChar) {
+                            ++j;  // Skip escaped quote
+                        } else {
+                            inQuotes = false;
+                        }
+                    }
+                    continue;
+                }
+
+                if (current == '"' || current == '\'') {
+                    inQuotes = true;
+                    quoteChar = current;
+                } else if (current == '(') {
+                    if (parenDepth == 0) {
+                        funcStart = i + 2;
+                        foundFunc = true;
+                    }
+                    ++parenDepth;
+                } else if (current == ')') {
+                    --parenDepth;
+                    if (parenDepth == 0 && foundFunc) {
+                        if (j + 2 < result.size() && result[j + 1] == '}' && result[j + 2] == '}') {
+                            const std::string expression = result.substr(funcStart, j - funcStart + 1);
+                            const std::string functionResult = parseFunctionExpression(*variables, expression);
+                            result.replace(i, j + 3 - i, functionResult);
+                            processed = true;
+                        }
+                        break;
+                    }
+                } else if (current == '}' && result[j + 1] == '}' && !foundFunc) {
+                    break;  // Not a function, continue searching
+                }
+            }
+        }
+        ++iteration;
+    } while (processed && iteration < maxIterations);
+
+    // Finally, replace normal placeholders {{variableName}} with variable values
+    for (const auto* variable : *variables) {
+        if (variable == nullptr) {
+            continue;
+        }
+        const std::string value = variable->getText();
+        result = replaceAll(result, "{{" + variable->getName() + "}}", value);
+    }
+
+    return result;
+}
+
+std::string PromptBuilder::resolveVariableValue(const std::vector<Variable*>& variables, const std::string& variableName) const {
+    const std::string lowerName = toLower(variableName);
+    for (const auto* variable : variables) {
+        if (variable != nullptr && toLower(variable->getName()) == lowerName) {
+            return variable->getText();
+        }
+    }
+    return "";
+}
+
+std::string PromptBuilder::executeFunction(const std::string& functionName, const std::vector<std::string>& arguments) {
+    const std::string name = toLower(functionName);
+    const size_t argCount = arguments.size();
+
+    if (name == "upper") {
+        if (argCount != 1) {
+            throw std::invalid_argument("Function \"upper\" expects 1 argument, got " + std::to_string(argCount));
+        }
+        return toUpper(arguments[0]);
+    } else if (name == "lower") {
+        if (argCount != 1) {
+            throw std::invalid_argument("Function \"lower\" expects 1 argument, got " + std::to_string(argCount));
+        }
+        return toLower(arguments[0]);
+    } else if (name == "replace") {
+        if (argCount != 3) {
+            throw std::invalid_argument("Function \"replace\" expects 3 arguments, got " + std::to_string(argCount));
+        }
+        return replaceAll(arguments[2], arguments[0], arguments[1]);
+    }
+
+    throw std::invalid_argument("Unknown function: " + functionName);
+}
+
+std::string PromptBuilder::parseFunctionExpression(const std::vector<Variable*>& variables, const std::string& expression) const {
+    const size_t openParen = expression.find('(');
+    if (openParen == std::string::npos) {
+        throw std::invalid_argument("Invalid function expression: " + expression);
+    }
+
+    const std::string functionName = trim(expression.substr(0, openParen));
+    std::string argsString = expression.substr(openParen + 1);
+    while (!argsString.empty() && argsString.back() == ')') {
+        argsString.pop_back();
+    }
+
+    // Split arguments on top-level commas
+    std::vector<std::string> rawArguments;
+    if (!trim(argsString).empty()) {
+        size_t startPos = 0;
+        bool inQuotes = false;
+        char quoteChar = '\0';
+        int functionDepth = 0;
+
+        for (size_t j = 0; j < argsString.size(); ++j) {
+            const char current = argsString[j];
+            if (inQuotes) {
+                if (current == quoteChar) {
+                    if (j + 1 < argsString.size() && argsString[j + 1] == quoteChar) {
+                        ++j;  // Skip escaped quote
+                    } else {
+                        inQuotes = false;
+                    }
+                }
+            } else if (current == '"' || current == '\'') {
+                inQuotes = true;
+                quoteChar = current;
+            } else if (current == '(') {
+                ++functionDepth;
+            } else if (current == ')') {
+                --functionDepth;
+            } else if (current == ',' && functionDepth == 0) {
+                const std::string argument = trim(argsString.substr(startPos, j - startPos));
+                if (!argument.empty()) {
+                    rawArguments.push_back(argument);
+                }
+                startPos = j + 1;
+            }
+        }
+
+        const std::string lastArgument = trim(argsString.substr(startPos));
+        if (!lastArgument.empty()) {
+            rawArguments.push_back(lastArgument);
+        }
+    }
+
+    // Resolve arguments: string literals, nested functions or variable names
+    std::vector<std::string> arguments;
+    arguments.reserve(rawArguments.size());
+    for (const auto& argument : rawArguments) {
+        const char first = argument.front();
+        if (argument.size() >= 2 && (first == '"' || first == '\'') && argument.back() == first) {
+            const std::string quote(1, first);
+            arguments.push_back(replaceAll(argument.substr(1, argument.size() - 2), quote + quote, quote));
+        } else if (argument.find('(') != std::string::npos) {
+            // Nested function; close it if the outer split consumed its ')'
+            std::string nested = argument;
+            int depth = 0;
+            for (size_t k = nested.find('('); k < nested.size(); ++k) {
+                if (nested[k] == '(') {
+                    ++depth;
+                } else if (nested[k] == ')' && --depth == 0) {
+                    break;
+                }
+            }
+            if (depth > 0) {
+                nested += ')';
+            }
+            arguments.push_back(parseFunctionExpression(variables, nested));
+        } else {
+            arguments.push_back(resolveVariableValue(variables, argument));
+        }
+    }
+
+    return executeFunction(functionName, arguments);
+}
+
+} // namespace TemplateBuilder
@@ -0,0 +1,39 @@
+#pragma once
+
+#include <string>
+#include <vector>
+#include <iostream>
+#include "types/PromptType.hpp"
+#include "types/VariableType.hpp"
+
+namespace TemplateBuilder {
+
+class PromptBuilder {
+public:
+    // Constructors
+    PromptBuilder();
+    PromptBuilder(std::istream& input, std::ostream& output);
+
+    // Runs every input of the prompt and renders its result
+    std::string build(Prompt* prompt, const std::vector<Variable*>* variables);
+
+    // Collects user input without rendering
+    void collect(Prompt& prompt);
+    void collectInput(PromptInput& promptInput);
+
+    // Template rendering ({{variable}}, {{"prefix" | variable}}, {{function(...)}})
+    [[nodiscard]] std::string getContent(const std::string& content, const std::vector<Variable*>* variables) const;
+
+private:
+    void getInputString(PromptInput& promptInput);
+    void getChecklist(PromptInput& promptInput);
+    void getArrayList(PromptInput& promptInput);
+    [[nodiscard]] std::string resolveVariableValue(const std::vector<Variable*>& variables, const std::string& variableName) const;
+    [[nodiscard]] std::string parseFunctionExpression(const std::vector<Variable*>& variables, const std::string& expression) const;
+    [[nodiscard]] static std::string executeFunction(const std::string& functionName, const std::vector<std::string>& arguments);
+
+    std::istream& m_input;
+    std::ostream& m_output;
+};
+
+} // namespace TemplateBuilder
@@ -0,0 +1,494 @@
+#include "builders/UringSink.hpp"
+#include "builders/FolderBuilder.hpp"
+#include <algorithm>
+#include <stdexcept>
+#include <system_error>
+#include <unordered_map>
+#include <unordered_set>
+
+#ifdef TEMPLATEBUILDER_HAVE_IO_URING
+#include <linux/io_uring.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <cerrno>
+#include <cstring>
+#endif
+
+namespace TemplateBuilder {
+
+namespace {
+
+// Larger contents are rare and bypass the ring (write lengths are 32-bit)
+constexpr size_t MAX_QUEUED_CONTENT = size_t(1) << 30;
+
+} // namespace
+
+#ifdef TEMPLATEBUILDER_HAVE_IO_URING
+
+namespace {
+
+std::filesystem::path normalizeDirectory(const std::filesystem::path& directory) {
+    std::filesystem::path normalized = directory.lexically_normal();
+    if (normalized.filename().empty() && normalized.has_relative_path()) {
+        normalized = normalized.parent_path();
+    }
+    return normalized;
+}
+
+constexpr unsigned RING_ENTRIES = 512;
+constexpr unsigned FILE_SLOTS = 128;  // Each file takes up to three entries
+
+// Operation tag stored in the low bits of user_data
+enum : unsigned { OP_MKDIR = 0, OP_OPEN = 1, OP_WRITE = 2, OP_CLOSE = 3 };
+
+__u64 userData(size_t index, unsigned op) {
+    return (static_cast<__u64>(index) << 2) | op;
+}
+
+} // namespace
+
+// Minimal submission/completion ring over the raw syscalls, so the backend
+// needs the kernel headers only and not liburing
+class UringQueue {
+public:
+    // Returns nullptr when io_uring or one of the required operations is
+    // unavailable. MKDIRAT and direct (fixed table) open/close both arrived
+    // in Linux 5.15, so probing for MKDIRAT covers them all.
+    static std::unique_ptr<UringQueue> create() {
+        io_uring_params params;
+        std::memset(&params, 0, sizeof(params));
+        const int fd = static_cast<int>(::syscall(__NR_io_uring_setup, RING_ENTRIES, &params));
+        if (fd < 0) {
+            return nullptr;
+        }
+
+        std::unique_ptr<UringQueue> queue(new UringQueue(fd));
+        if ((params.features & IORING_FEAT_SINGLE_MMAP) == 0 || !queue->map(params) ||
+            !queue->probe() || !queue->registerFileSlots()) {
+            return nullptr;
+        }
+        return queue;
+    }
+
+    ~UringQueue() {
+        if (m_sqes != MAP_FAILED) {
+            ::munmap(m_sqes, m_sqesSize);
+        }
+        if (m_ring != MAP_FAILED) {
+            ::munmap(m_ring, m_ringSize);
+        }
+        ::close(m_fd);
+    }
+
+    UringQueue(const UringQueue&) = delete;
+    UringQueue& operator=(const UringQueue&) = delete;
+
+    // Next free submission entry, zeroed; callers stay within getCapacity()
+    io_uring_sqe* next() {
+        io_uring_sqe* sqe = &m_sqes[m_tail & m_sqMask];
+        std::memset(sqe, 0, sizeof(*sqe));
+        m_sqArray[m_tail & m_sqMask] = m_tail & m_sqMask;
+        ++m_tail;
+        ++m_queued;
+        return sqe;
+    }
+
+    // Submits everything queued and waits for all of it; every entry,
+    // including cancelled links, produces exactly one completion
+    template <typename OnComplete>
+    void submitAndWait(OnComplete onComplete) {
+        unsigned expected = m_queued;
+        unsigned toSubmit = m_queued;
+        m_queued = 0;
+        __atomic_store_n(m_sqTail, m_tail, __ATOMIC_RELEASE);
+
+        while (expected > 0) {
+            const int result = static_cast<int>(::syscall(__NR_io_uring_enter, m_fd, toSubmit, expected,
+                                                          IORING_ENTER_GETEVENTS, nullptr, 0));
+            if (result < 0) {
+                if (errno == EINTR || errno == EAGAIN || errno == EBUSY) {
+                    continue;
+                }
+                throw std::system_error(errno, std::generic_category(), "io_uring_enter failed");
+            }
+            toSubmit -= std::min<unsigned>(toSubmit, static_cast<unsigned>(result));
+
+            unsigned head = *m_cqHead;
+            const unsigned tail = __atomic_load_n(m_cqTail, __ATOMIC_ACQUIRE);
+            for (; head != tail && expected > 0; ++head, --expected) {
+                const io_uring_cqe& cqe = m_cqes[head & m_cqMask];
+                onComplete(cqe.user_data, cqe.res);
+            }
+            __atomic_store_n(m_cqHead, head, __ATOMIC_RELEASE);
+        }
+    }
+
+    [[nodiscard]] unsigned getCapacity() const noexcept { return m_sqEntries; }
+
+private:
+    explicit UringQueue(int fd) : m_fd(fd) {}
+
+    bool map(const io_uring_params& params) {
+        m_sqEntries = params.sq_entries;
+        const size_t sqSize = params.sq_off.array + params.sq_entries * sizeof(unsigned);
+        const size_t cqSize = params.cq_off.cqes + params.cq_entries * sizeof(io_uring_cqe);
+        m_ringSize = std::max(sqSize, cqSize);
+        m_ring = ::mmap(nullptr, m_ringSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, m_fd, IORING_OFF_SQ_RING);
+        if (m_ring == MAP_FAILED) {
+            return false;
+        }
+        m_sqesSize = params.sq_entries * sizeof(io_uring_sqe);
+        void* sqes = ::mmap(nullptr, m_sqesSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, m_fd, IORING_OFF_SQES);
+        if (sqes == MAP_FAILED) {
+            return false;
+        }
+        m_sqes = static_cast<io_uring_sqe*>(sqes);
+
+        char* ring = static_cast<char*>(m_ring);
+        m_sqTail = reinterpret_cast<unsigned*>(ring + params.sq_off.tail);
+        m_sqMask = *reinterpret_cast<unsigned*>(ring + params.sq_off.ring_mask);
+        m_sqArray = reinterpret_cast<unsigned*>(ring + params.sq_off.array);
+        m_cqHead = reinterpret_cast<unsigned*>(ring + params.cq_off.head);
+        m_cqTail = reinterpret_cast<unsigned*>(ring + params.cq_off.tail);
+        m_cqMask = *reinterpret_cast<unsigned*>(ring + params.cq_off.ring_mask);
+        m_cqes = reinterpret_cast<io_uring_cqe*>(ring + params.cq_off.cqes);
+        m_tail = *m_sqTail;
+        return true;
+    }
+
+    bool probe() {
+        constexpr unsigned opCount = 256;
+        std::vector<char> buffer(sizeof(io_uring_probe) + opCount * sizeof(io_uring_probe_op), 0);
+        auto* probe = reinterpret_cast<io_uring_probe*>(buffer.data());
+        if (::syscall(__NR_io_uring_register, m_fd, IORING_REGISTER_PROBE, probe, opCount) < 0) {
+            return false;
+        }
+        for (const unsigned op : {IORING_OP_OPENAT, IORING_OP_WRITE, IORING_OP_CLOSE, IORING_OP_MKDIRAT}) {
+            if (op > probe->last_op || (probe->ops[op].flags & IO_URING_OP_SUPPORTED) == 0) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    // Files are opened straight into a sparse fixed table so the write and
+    // close can be linked behind the open without the descriptor
+    bool registerFileSlots() {
+        std::vector<int> slots(FILE_SLOTS, -1);
+        return ::syscall(__NR_io_uring_register, m_fd, IORING_REGISTER_FILES, slots.data(), FILE_SLOTS) >= 0;
+    }
+
+    int m_fd;
+    void* m_ring = MAP_FAILED;
+    size_t m_ringSize = 0;
+    io_uring_sqe* m_sqes = static_cast<io_uring_sqe*>(MAP_FAILED);
+    size_t m_sqesSize = 0;
+    unsigned m_sqEntries = 0;
+
+    unsigned* m_sqTail = nullptr;
+    unsigned m_sqMask = 0;
+    unsigned* m_sqArray = nullptr;
+    unsigned* m_cqHead = nullptr;
+    unsigned* m_cqTail = nullptr;
+    unsigned m_cqMask = 0;
+    io_uring_cqe* m_cqes = nullptr;
+
+    unsigned m_tail = 0;
+    unsigned m_queued = 0;
+};
+
+#else
+
+class UringQueue {};
+
+#endif
+
+UringSink::UringSink(const std::filesystem::path& root, size_t batchSize)
+    : UringSink(root, std::make_shared<DirectoryCache>(), batchSize) {
+}
+
+UringSink::UringSink(const std::filesystem::path& root, std::shared_ptr<DirectoryCache> directories, size_t batchSize)
+    : m_fallback(root, directories), m_batchSize(std::max<size_t>(1, batchSize)), m_directories(std::move(directories)) {
+#ifdef TEMPLATEBUILDER_HAVE_IO_URING
+    m_queue = UringQueue::create();
+    if (m_queue) {
+        m_directories->ensure(getRoot());
+    }
+#endif
+}
+
+UringSink::~UringSink() {
+    try {
+        flush();
+    } catch (...) {
+        // Errors are reported by an explicit flush()
+    }
+}
+
+bool UringSink::isSupported() {
+#ifdef TEMPLATEBUILDER_HAVE_IO_URING
+    return UringQueue::create() != nullptr;
+#else
+    return false;
+#endif
+}
+
+void UringSink::writeFile(const std::string& path, const std::string& content) {
+    if (!m_queue) {
+        m_fallback.writeFile(path, content);
+        return;
+    }
+    if (path.empty()) {
+        throw std::runtime_error("File path cannot be empty.");
+    }
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (content.size() > MAX_QUEUED_CONTENT) {
+        flushLocked();
+        m_fallback.writeFile(path, content);
+        return;
+    }
+
+    // Chains in one batch run concurrently, so a path written twice keeps
+    // a single entry with the latest content
+    const auto pending = m_pendingIndex.find(path);
+    if (pending != m_pendingIndex.end()) {
+        m_pendingFiles[pending->second].content = content;
+        return;
+    }
+    m_pendingIndex.emplace(path, m_pendingFiles.size());
+    m_pendingFiles.push_back({path, content});
+    if (m_pendingFiles.size() >= m_batchSize) {
+        flushLocked();
+    }
+}
+
+void UringSink::createFolder(const std::string& path) {
+    if (!m_queue) {
+        m_fallback.createFolder(path);
+        return;
+    }
+    if (path.empty()) {
+        throw std::runtime_error("Folder path cannot be empty.");
+    }
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_pendingFolders.push_back(path);
+}
+
+void UringSink::flush() {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    flushLocked();
+
+    if (m_reportedFailures < m_failures.size()) {
+        const WriteFailure& failure = m_failures[m_reportedFailures];
+        m_reportedFailures = m_failures.size();
+        throw std::system_error(failure.error, std::generic_category(), failure.message);
+    }
+}
+
+size_t UringSink::getFilesWritten() const {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_filesWritten + m_fallback.getFilesWritten();
+}
+
+std::vector<WriteFailure> UringSink::getFailures() const {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_failures;
+}
+
+#ifdef TEMPLATEBUILDER_HAVE_IO_URING
+
+void UringSink::flushLocked() {
+    if (m_pendingFiles.empty() && m_pendingFolders.empty()) {
+        return;
+    }
+
+    try {
+        createDirectories();
+        writeFiles();
+    } catch (...) {
+        m_pendingFiles.clear();
+        m_pendingIndex.clear();
+        m_pendingFolders.clear();
+        throw;
+    }
+    m_pendingFiles.clear();
+    m_pendingIndex.clear();
+    m_pendingFolders.clear();
+}
+
+void UringSink::createDirectories() {
+    // Every missing directory, ancestors included, grouped by depth so a
+    // level is only created once its parents exist
+    std::vector<std::vector<std::string>> levels;
+    std::unordered_set<std::string> missing;
+    const auto require = [&](std::filesystem::path directory) {
+        directory = normalizeDirectory(directory);
+        std::vector<std::string> chain;
+        while (!directory.empty() && directory != directory.root_path()) {
+            std::string key = directory.string();
+            if (missing.count(key) != 0 || m_directories->contains(directory)) {
+                break;
+            }
+            chain.push_back(std::move(key));
+            directory = directory.parent_path();
+        }
+        for (const auto& key : chain) {
+            missing.insert(key);
+            const std::filesystem::path path(key);
+            const size_t depth = static_cast<size_t>(std::distance(path.begin(), path.end()));
+            if (levels.size() < depth) {
+                levels.resize(depth);
+            }
+            levels[depth - 1].push_back(key);
+        }
+    };
+
+    for (const auto& file : m_pendingFiles) {
+        require((getRoot() / file.path).parent_path());
+    }
+    for (const auto& folder : m_pendingFolders) {
+        require(FolderBuilder::directoryOf(getRoot() / folder, folder));
+    }
+
+    std::unordered_map<std::string, WriteFailure> failed;
+    for (const auto& level : levels) {
+        for (size_t start = 0; start < level.size(); start += m_queue->getCapacity()) {
+            const size_t end = std::min(level.size(), start + m_queue->getCapacity());
+            for (size_t i = start; i < end; ++i) {
+                io_uring_sqe* sqe = m_queue->next();
+                sqe->opcode = IORING_OP_MKDIRAT;
+                sqe->fd = AT_FDCWD;
+                sqe->addr = reinterpret_cast<__u64>(level[i].c_str());
+                sqe->len = 0777;
+                sqe->user_data = userData(i, OP_MKDIR);
+            }
+            m_queue->submitAndWait([&](__u64 data, int result) {
+                const std::string& directory = level[data >> 2];
+                if (result == 0 || result == -EEXIST) {
+                    m_directories->add(directory);
+                } else {
+                    failed[directory] = {directory, -result, "Unable to create directory: " + directory};
+                }
+            });
+        }
+    }
+
+    // Files under a failed directory fail on open; folders are reported here
+    for (const auto& folder : m_pendingFolders) {
+        std::filesystem::path directory = normalizeDirectory(FolderBuilder::directoryOf(getRoot() / folder, folder));
+        while (!directory.empty() && directory != directory.root_path()) {
+            const auto found = failed.find(directory.string());
+            if (found != failed.end()) {
+                m_failures.push_back({folder, found->second.error, found->second.message});
+                break;
+            }
+            directory = directory.parent_path();
+        }
+    }
+}
+
+void UringSink::writeFiles() {
+    struct FileState {
+        std::string fullPath;
+        bool opened = false;
+        int error = 0;
+    };
+
+    const size_t chunkSize = std::min<size_t>(FILE_SLOTS, m_queue->getCapacity() / 3);
+    for (size_t start = 0; start < m_pendingFiles.size(); start += chunkSize) {
+        const size_t end = std::min(m_pendingFiles.size(), start + chunkSize);
+        std::vector<FileState> states(end - start);
+
+        for (size_t i = start; i < end; ++i) {
+            const PendingFile& file = m_pendingFiles[i];
+            const unsigned slot = static_cast<unsigned>(i - start);
+            FileState& state = states[slot];
+            state.fullPath = (getRoot() / file.path).string();
+
+            io_uring_sqe* open = m_queue->next();
+            open->opcode = IORING_OP_OPENAT;
+            open->fd = AT_FDCWD;
+            open->addr = reinterpret_cast<__u64>(state.fullPath.c_str());
+            open->len = 0666;
+            open->open_flags = O_WRONLY | O_CREAT | O_TRUNC;  // Direct descriptors reject O_CLOEXEC
+            open->file_index = slot + 1;
+            open->flags = IOSQE_IO_LINK;
+            open->user_data = userData(slot, OP_OPEN);
+
+            if (!file.content.empty()) {
+                io_uring_sqe* write = m_queue->next();
+                write->opcode = IORING_OP_WRITE;
+                write->fd = static_cast<__s32>(slot);
+                write->flags = IOSQE_FIXED_FILE | IOSQE_IO_LINK;
+                write->addr = reinterpret_cast<__u64>(file.content.data());
+                write->len = static_cast<__u32>(file.content.size());
+                write->off = 0;
+                write->user_data = userData(slot, OP_WRITE);
+            }
+
+            io_uring_sqe* close = m_queue->next();
+            close->opcode = IORING_OP_CLOSE;
+            close->file_index = slot + 1;
+            close->user_data = userData(slot, OP_CLOSE);
+        }
+
+        std::vector<unsigned> leaked;
+        m_queue->submitAndWait([&](__u64 data, int result) {
+            const unsigned slot = static_cast<unsigned>(data >> 2);
+            FileState& state = states[slot];
+            switch (static_cast<unsigned>(data & 3)) {
+                case OP_OPEN:
+                    state.opened = result >= 0;
+                    break;
+                case OP_WRITE:
+                    if (result >= 0 && static_cast<size_t>(result) < m_pendingFiles[start + slot].content.size()) {
+                        result = -EIO;  // A short write breaks the link before close
+                    }
+                    break;
+                case OP_CLOSE:
+                    if (result == -ECANCELED && state.opened) {
+                        leaked.push_back(slot);
+                    }
+                    break;
+            }
+            if (result < 0 && result != -ECANCELED && state.error == 0) {
+                state.error = -result;
+            }
+        });
+
+        // Release slots whose linked close never ran so the next chunk starts clean
+        if (!leaked.empty()) {
+            for (const unsigned slot : leaked) {
+                io_uring_sqe* close = m_queue->next();
+                close->opcode = IORING_OP_CLOSE;
+                close->file_index = slot + 1;
+                close->user_data = userData(slot, OP_CLOSE);
+            }
+            m_queue->submitAndWait([](__u64, int) {});
+        }
+
+        for (size_t slot = 0; slot < states.size(); ++slot) {
+            const FileState& state = states[slot];
+            if (state.error == 0 && state.opened) {
+                ++m_filesWritten;
+            } else {
+                m_failures.push_back({m_pendingFiles[start + slot].path, state.error != 0 ? state.error : ECANCELED,
+                                      "Unable to write file: " + state.fullPath});
+            }
+        }
+    }
+}
+
+#else
+
+void UringSink::flushLocked() {
+    // Without io_uring every write went straight to the fallback sink
+}
+
+#endif
+
+} // namespace TemplateBuilder
@@ -0,0 +1,86 @@
+#pragma once
+
+#include <filesystem>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+#include "builders/OutputSink.hpp"
+
+namespace TemplateBuilder {
+
+class UringQueue;
+
+struct WriteFailure {
+    std::string path;  // File or folder path as passed to the sink
+    int error = 0;     // errno value
+    std::string message;
+};
+
+// Writes output below a root directory through Linux io_uring. Files are
+// queued and written in batches: missing directories are created with one
+// round of mkdirat per depth level, then every file becomes a linked
+// openat/write/close chain, so a batch of small files costs a couple of
+// io_uring_enter calls instead of several syscalls per file.
+//
+// When io_uring is unavailable (other platforms, older kernels, or disabled
+// by policy) writes go straight through a DirectorySink instead.
+//
+// A batch that fills up is written from writeFile() without throwing; its
+// failures are recorded and surface from the next flush(). The destructor
+// flushes but cannot report them, so callers should flush() explicitly.
+// Sinks sharing a DirectoryCache skip directories any of them created.
+class UringSink : public OutputSink {
+public:
+    static constexpr size_t DEFAULT_BATCH_SIZE = 1024;
+
+    explicit UringSink(const std::filesystem::path& root, size_t batchSize = DEFAULT_BATCH_SIZE);
+    UringSink(const std::filesystem::path& root, std::shared_ptr<DirectoryCache> directories,
+              size_t batchSize = DEFAULT_BATCH_SIZE);
+    ~UringSink() override;
+
+    UringSink(const UringSink&) = delete;
+    UringSink& operator=(const UringSink&) = delete;
+
+    void writeFile(const std::string& path, const std::string& content) override;
+    void createFolder(const std::string& path) override;
+
+    // Writes everything queued so far; throws std::system_error naming the
+    // first file or folder that failed since the previous flush()
+    void flush();
+
+    // Whether this build and the running kernel support the io_uring backend
+    [[nodiscard]] static bool isSupported();
+
+    // Getters
+    [[nodiscard]] const std::filesystem::path& getRoot() const noexcept { return m_fallback.getRoot(); }
+    [[nodiscard]] bool isUringActive() const noexcept { return m_queue != nullptr; }
+    [[nodiscard]] size_t getFilesWritten() const;
+    [[nodiscard]] std::vector<WriteFailure> getFailures() const;
+
+private:
+    struct PendingFile {
+        std::string path;
+        std::string content;
+    };
+
+    void flushLocked();
+    void createDirectories();
+    void writeFiles();
+
+    DirectorySink m_fallback;
+    std::unique_ptr<UringQueue> m_queue;
+    size_t m_batchSize;
+
+    mutable std::mutex m_mutex;
+    std::vector<PendingFile> m_pendingFiles;
+    std::unordered_map<std::string, size_t> m_pendingIndex;
+    std::vector<std::string> m_pendingFolders;
+    std::shared_ptr<DirectoryCache> m_directories;
+    std::vector<WriteFailure> m_failures;
+    size_t m_reportedFailures = 0;
+    size_t m_filesWritten = 0;
+};
+
+} // namespace TemplateBuilder
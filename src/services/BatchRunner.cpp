@@ -0,0 +1,302 @@
+#include "services/BatchRunner.hpp"
+#include "builders/UringSink.hpp"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <fstream>
+#include <optional>
+#include <stdexcept>
+#include <thread>
+#include <unordered_map>
+#include <yaml-cpp/yaml.h>
+
+namespace TemplateBuilder {
+
+namespace {
+
+bool isTemplateFile(const std::filesystem::path& path) {
+    const std::string extension = path.extension().string();
+    return extension == ".yaml" || extension == ".yml";
+}
+
+std::string trim(const std::string& value) {
+    const auto first = value.find_first_not_of(" \t\r\n");
+    if (first == std::string::npos) {
+        return "";
+    }
+    const auto last = value.find_last_not_of(" \t\r\n");
+    return value.substr(first, last - first + 1);
+}
+
+} // namespace
+
+BatchRunner::BatchRunner()
+    : BatchRunner(std::max(1u, std::thread::hardware_concurrency())) {
+}
+
+BatchRunner::BatchRunner(size_t threadCount)
+    : m_threadCount(std::max<size_t>(1, threadCount)) {
+}
+
+std::vector<std::string> BatchRunner::collectTemplates(const std::vector<std::string>& arguments) {
+    std::vector<std::string> templates;
+
+    for (const auto& argument : arguments) {
+        if (!argument.empty() && argument.front() == '@') {
+            // Manifest: one template per line, relative to the manifest, '#' comments
+            const std::filesystem::path manifest = argument.substr(1);
+            std::ifstream stream(manifest);
+            if (!stream) {
+                throw std::runtime_error("Manifest not found: " + manifest.string());
+            }
+            std::string line;
+            while (std::getline(stream, line)) {
+                line = trim(line);
+                if (line.empty() || line.front() == '#') {
+                    continue;
+                }
+                const std::filesystem::path path(line);
+                templates.push_back((path.is_absolute() ? path : manifest.parent_path() / path).string());
+            }
+        } else if (std::filesystem::is_directory(argument)) {
+            std::vector<std::string> found;
+            for (const auto& entry : std::filesystem::directory_iterator(argument)) {
+                if (entry.is_regular_file() && isTemplateFile(entry.path())) {
+                    found.push_back(entry.path().string());
+                }
+            }
+            std::sort(found.begin(), found.end());
+            templates.insert(templates.end(), found.begin(), found.end());
+        } else {
+            templates.push_back(argument);
+        }
+    }
+
+    return templates;
+}
+
+std::vector<BatchResult> BatchRunner::run(const std::vector<std::string>& templates,
+                                          const std::filesystem::path& outputRoot) {
+    std::vector<BatchResult> results(templates.size());
+    std::vector<std::optional<Template>> loaded(templates.size());
+    std::vector<std::vector<std::string>> outputs(templates.size());
+    std::vector<std::vector<std::string>> folders(templates.size());
+
+    // A template listed more than once (say by a directory and a manifest) is
+    // rendered once; its repeats report the same result
+    std::vector<size_t> first(templates.size());
+    std::unordered_map<std::string, size_t> firstByKey;
+    for (size_t i = 0; i < templates.size(); ++i) {
+        std::error_code error;
+        std::string key = std::filesystem::weakly_canonical(templates[i], error).string();
+        if (error) {
+            key = templates[i];
+        }
+        first[i] = firstByKey.emplace(key, i).first->second;
+    }
+
+    // Load every template and list what it will write before anything is written
+    forEach(templates.size(), [&](size_t i, size_t) {
+        results[i].templatePath = templates[i];
+        if (first[i] != i) {
+            return;
+        }
+        attempt(results[i], [&]() {
+            loaded[i] = m_cache.load(templates[i]);
+            outputs[i] = loaded[i]->getOutputPaths();
+            folders[i] = loaded[i]->getOutputFolders();
+        });
+    });
+
+    rejectCollisions(outputs, outputRoot, results);
+
+    if (m_ioUring) {
+        renderWithUring(loaded, outputs, folders, outputRoot, results);
+    } else {
+        forEach(templates.size(), [&](size_t i, size_t) {
+            if (!loaded[i] || !results[i].error.empty()) {
+                return;
+            }
+            attempt(results[i], [&]() {
+                DirectorySink sink(outputRoot, m_cache.getDirectories());
+                loaded[i]->render(sink);
+                results[i].files = sink.getFilesWritten();
+            });
+            results[i].success = results[i].error.empty();
+        });
+    }
+
+    for (size_t i = 0; i < templates.size(); ++i) {
+        if (first[i] != i) {
+            results[i] = results[first[i]];
+            results[i].templatePath = templates[i];
+        }
+    }
+
+    return results;
+}
+
+void BatchRunner::forEach(size_t count, const std::function<void(size_t index, size_t worker)>& task) const {
+    std::atomic<size_t> next{0};
+    const auto worker = [&](size_t id) {
+        for (size_t i = next++; i < count; i = next++) {
+            task(i, id);
+        }
+    };
+
+    const size_t threadCount = std::min(m_threadCount, count);
+    std::vector<std::thread> threads;
+    for (size_t t = 1; t < threadCount; ++t) {
+        threads.emplace_back(worker, t);
+    }
+    worker(0);
+    for (auto& thread : threads) {
+        thread.join();
+    }
+}
+
+void BatchRunner::attempt(BatchResult& result, const std::function<void()>& step) {
+    const auto start = std::chrono::steady_clock::now();
+    try {
+        step();
+    } catch (const YAML::Exception& e) {
+        result.error = std::string("Error parsing YAML: ") + e.what();
+    } catch (const std::exception& e) {
+        result.error = e.what();
+    }
+    result.milliseconds += std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+}
+
+void BatchRunner::rejectCollisions(const std::vector<std::vector<std::string>>& outputs,
+                                   const std::filesystem::path& outputRoot, std::vector<BatchResult>& results) {
+    // Templates share the output root; two of them writing one file would race,
+    // so every template involved in a collision fails and none of them writes
+    std::unordered_map<std::string, size_t> owners;
+    for (size_t i = 0; i < outputs.size(); ++i) {
+        for (const auto& path : outputs[i]) {
+            const auto [owner, inserted] = owners.emplace(outputKey(outputRoot, path), i);
+            if (inserted || owner->second == i) {
+                continue;
+            }
+
+            const std::string collision = "Output path " + path + " is written by both " +
+                                          results[owner->second].templatePath + " and " + results[i].templatePath;
+            for (const size_t index : {owner->second, i}) {
+                if (results[index].error.empty()) {
+                    results[index].error = collision;
+                }
+            }
+        }
+    }
+}
+
+void BatchRunner::renderWithUring(const std::vector<std::optional<Template>>& loaded,
+                                  const std::vector<std::vector<std::string>>& outputs,
+                                  const std::vector<std::vector<std::string>>& folders,
+                                  const std::filesystem::path& outputRoot, std::vector<BatchResult>& results) {
+    // One ring per worker, kept across templates so a submission batches the
+    // files of every template the worker renders; directories are shared
+    std::vector<std::unique_ptr<UringSink>> sinks(std::min(m_threadCount, loaded.size()));
+    std::vector<size_t> renderedBy(loaded.size(), 0);
+    std::vector<char> rendered(loaded.size(), 0);
+    forEach(loaded.size(), [&](size_t i, size_t worker) {
+        if (!loaded[i] || !results[i].error.empty()) {
+            return;
+        }
+        attempt(results[i], [&]() {
+            if (!sinks[worker]) {
+                sinks[worker] = std::make_unique<UringSink>(outputRoot, m_cache.getDirectories());
+            }
+            renderedBy[i] = worker;
+            loaded[i]->render(*sinks[worker]);
+            rendered[i] = 1;
+        });
+    });
+
+    std::vector<std::string> sinkErrors(sinks.size());
+    std::vector<double> flushMilliseconds(sinks.size(), 0.0);
+    forEach(sinks.size(), [&](size_t worker, size_t) {
+        if (!sinks[worker]) {
+            return;
+        }
+        const auto start = std::chrono::steady_clock::now();
+        try {
+            sinks[worker]->flush();
+        } catch (const std::exception& e) {
+            if (sinks[worker]->getFailures().empty()) {
+                sinkErrors[worker] = e.what();  // The ring itself failed, not one file
+            }
+        }
+        flushMilliseconds[worker] = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+    });
+
+    // The flush writes every file a worker queued, so its time is shared out
+    // among that worker's templates by the number of files each one queued
+    std::vector<size_t> filesQueued(sinks.size(), 0);
+    std::vector<size_t> templatesRendered(sinks.size(), 0);
+    for (size_t i = 0; i < loaded.size(); ++i) {
+        if (rendered[i]) {
+            filesQueued[renderedBy[i]] += outputs[i].size();
+            ++templatesRendered[renderedBy[i]];
+        }
+    }
+
+    // Output paths are unique per template after rejectCollisions, so each
+    // recorded failure belongs to the templates that declared its path
+    std::unordered_map<std::string, size_t> fileOwners;
+    std::unordered_map<std::string, std::vector<size_t>> folderOwners;
+    for (size_t i = 0; i < loaded.size(); ++i) {
+        if (!rendered[i]) {
+            continue;
+        }
+        for (const auto& path : outputs[i]) {
+            fileOwners[outputKey(outputRoot, path)] = i;
+        }
+        for (const auto& path : folders[i]) {
+            folderOwners[outputKey(outputRoot, path)].push_back(i);
+        }
+    }
+
+    std::vector<size_t> failedFiles(loaded.size(), 0);
+    for (const auto& sink : sinks) {
+        if (!sink) {
+            continue;
+        }
+        for (const auto& failure : sink->getFailures()) {
+            const std::string key = outputKey(outputRoot, failure.path);
+            std::vector<size_t> owners;
+            if (const auto file = fileOwners.find(key); file != fileOwners.end()) {
+                owners.push_back(file->second);
+                ++failedFiles[file->second];
+            } else if (const auto folder = folderOwners.find(key); folder != folderOwners.end()) {
+                owners = folder->second;
+            }
+            for (const size_t i : owners) {
+                if (results[i].error.empty()) {
+                    results[i].error = failure.message;
+                }
+            }
+        }
+    }
+
+    for (size_t i = 0; i < loaded.size(); ++i) {
+        if (!rendered[i]) {
+            continue;  // Failed before or while rendering
+        }
+        const size_t worker = renderedBy[i];
+        results[i].milliseconds += filesQueued[worker] > 0
+            ? flushMilliseconds[worker] * static_cast<double>(outputs[i].size()) / static_cast<double>(filesQueued[worker])
+            : flushMilliseconds[worker] / static_cast<double>(templatesRendered[worker]);
+        if (results[i].error.empty()) {
+            results[i].error = sinkErrors[worker];
+        }
+        results[i].files = outputs[i].size() - std::min(outputs[i].size(), failedFiles[i]);
+        results[i].success = results[i].error.empty();
+    }
+}
+
+std::string BatchRunner::outputKey(const std::filesystem::path& outputRoot, const std::string& path) {
+    return (outputRoot / path).lexically_normal().string();
+}
+
+} // namespace TemplateBuilder
@@ -0,0 +1,64 @@
+#pragma once
+
+#include <filesystem>
+#include <functional>
+#include <optional>
+#include <string>
+#include <vector>
+#include "services/TemplateCache.hpp"
+
+namespace TemplateBuilder {
+
+struct BatchResult {
+    std::string templatePath;
+    bool success = false;
+    std::string error;
+    size_t files = 0;
+    double milliseconds = 0.0;  // Load and render, plus a share of the io_uring flush
+};
+
+// Renders many templates concurrently in one process. Templates share a
+// TemplateCache; a failing template is reported and does not stop the rest.
+// Templates that would write the same output file all fail before writing;
+// a template listed more than once is rendered once and reported per entry.
+// Prompts are not run: variables use the defaults declared in the YAML.
+class BatchRunner {
+public:
+    // Constructors
+    BatchRunner();
+    explicit BatchRunner(size_t threadCount);
+
+    // Expands arguments into template paths: directories contribute their
+    // *.yaml / *.yml files, "@file" reads a manifest with one path per line
+    [[nodiscard]] static std::vector<std::string> collectTemplates(const std::vector<std::string>& arguments);
+
+    // Renders every template into outputRoot; results keep the input order
+    [[nodiscard]] std::vector<BatchResult> run(const std::vector<std::string>& templates,
+                                               const std::filesystem::path& outputRoot);
+
+    // Setters
+    void setIoUring(bool ioUring) noexcept { m_ioUring = ioUring; }
+
+    // Getters
+    [[nodiscard]] size_t getThreadCount() const noexcept { return m_threadCount; }
+    [[nodiscard]] bool isIoUring() const noexcept { return m_ioUring; }
+    [[nodiscard]] const TemplateCache& getCache() const noexcept { return m_cache; }
+
+private:
+    // Runs task(index, worker) over [0, count) on up to getThreadCount() workers
+    void forEach(size_t count, const std::function<void(size_t index, size_t worker)>& task) const;
+    static void attempt(BatchResult& result, const std::function<void()>& step);
+    static void rejectCollisions(const std::vector<std::vector<std::string>>& outputs,
+                                 const std::filesystem::path& outputRoot, std::vector<BatchResult>& results);
+    void renderWithUring(const std::vector<std::optional<Template>>& loaded,
+                         const std::vector<std::vector<std::string>>& outputs,
+                         const std::vector<std::vector<std::string>>& folders,
+                         const std::filesystem::path& outputRoot, std::vector<BatchResult>& results);
+    [[nodiscard]] static std::string outputKey(const std::filesystem::path& outputRoot, const std::string& path);
+
+    size_t m_threadCount;
+    bool m_ioUring = false;  // Write through UringSink instead of DirectorySink
+    TemplateCache m_cache;
+};
+
+} // namespace TemplateBuilder
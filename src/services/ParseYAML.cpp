@@ -0,0 +1,371 @@
+#include "services/ParseYAML.hpp"
+#include <algorithm>
+#include <cctype>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+
+namespace TemplateBuilder {
+
+namespace {
+
+const std::vector<std::string> SUPPORTED_VERSIONS = {"1.0"};
+
+bool sameText(const std::string& left, const std::string& right) {
+    return left.size() == right.size() &&
+           std::equal(left.begin(), left.end(), right.begin(), [](unsigned char a, unsigned char b) {
+               return std::tolower(a) == std::tolower(b);
+           });
+}
+
+std::string readTextFile(const std::filesystem::path& path) {
+    std::ifstream stream(path, std::ios::binary);
+    if (!stream) {
+        throw std::runtime_error("Source file not found: " + path.string());
+    }
+    std::ostringstream content;
+    content << stream.rdbuf();
+    return content.str();
+}
+
+std::string scalarOrEmpty(const YAML::Node& node) {
+    return node.IsDefined() && !node.IsNull() ? node.as<std::string>() : "";
+}
+
+} // namespace
+
+ParserYAML::ParserYAML(const std::string& fileName)
+    : ParserYAML(fileName, PromptBuilder()) {
+}
+
+ParserYAML::ParserYAML(const std::string& fileName, const PromptBuilder& promptBuilder)
+    : ParserYAML(fileName, promptBuilder, SourceReader()) {
+}
+
+ParserYAML::ParserYAML(const std::string& fileName, const PromptBuilder& promptBuilder, SourceReader sourceReader)
+    : m_fileName(fileName), m_fileBuilder(promptBuilder), m_sourceReader(std::move(sourceReader)) {
+    if (fileName.empty()) {
+        throw std::runtime_error("YAML file not provided.");
+    }
+
+    if (!std::filesystem::exists(m_fileName)) {
+        throw std::runtime_error("YAML file not found: " + fileName);
+    }
+
+    m_baseDirectory = std::filesystem::absolute(m_fileName).parent_path();
+    m_document = YAML::LoadFile(fileName);
+    load();
+}
+
+ParserYAML::ParserYAML(const YAML::Node& document, const std::filesystem::path& baseDirectory,
+                       const PromptBuilder& promptBuilder)
+    : m_baseDirectory(std::filesystem::absolute(baseDirectory)), m_document(document), m_fileBuilder(promptBuilder) {
+    load();
+}
+
+std::unique_ptr<ParserYAML> ParserYAML::fromString(const std::string& yaml,
+                                                   const std::filesystem::path& baseDirectory,
+                                                   const PromptBuilder& promptBuilder) {
+    return std::unique_ptr<ParserYAML>(new ParserYAML(YAML::Load(yaml), baseDirectory, promptBuilder));
+}
+
+void ParserYAML::load() {
+    if (!m_document["version"].IsDefined()) {
+        throw std::runtime_error("Required field \"version\" not found in YAML.");
+    }
+
+    m_version = m_document["version"].as<std::string>();
+
+    validateVersion();
+    loadVariables();
+    loadPrompts();
+    loadFiles();
+    loadFolders();
+}
+
+void ParserYAML::validateVersion() {
+    if (std::find(SUPPORTED_VERSIONS.begin(), SUPPORTED_VERSIONS.end(), m_version) == SUPPORTED_VERSIONS.end()) {
+        std::string supported;
+        for (const auto& version : SUPPORTED_VERSIONS) {
+            supported += (supported.empty() ? "" : ", ") + version;
+        }
+        throw UnsupportedTemplateVersion("Template version not supported: " + m_version +
+                                         ". Supported versions: " + supported);
+    }
+}
+
+void ParserYAML::loadVariables() {
+    const YAML::Node variablesNode = m_document["variables"];
+    if (!variablesNode.IsDefined()) {
+        return;  // No variables section, list remains empty
+    }
+
+    if (!variablesNode.IsSequence()) {
+        throw std::runtime_error("\"variables\" must be a sequence (array) in YAML.");
+    }
+
+    for (size_t i = 0; i < variablesNode.size(); ++i) {
+        const YAML::Node item = variablesNode[i];
+
+        VariableType type;
+        try {
+            type = Variable::stringToType(scalarOrEmpty(item["type"]));
+        } catch (const std::invalid_argument&) {
+            throw std::runtime_error("Unknown variable type \"" + scalarOrEmpty(item["type"]) +
+                                     "\" at index " + std::to_string(i) + ".");
+        }
+
+        auto variable = std::make_unique<Variable>(scalarOrEmpty(item["name"]), type);
+        const YAML::Node valueNode = item["value"];
+        if (valueNode.IsDefined() && !valueNode.IsNull()) {
+            const std::string location = " for variable at index " + std::to_string(i) + ".";
+            if (type == VariableType::vtList) {
+                if (!valueNode.IsSequence()) {
+                    throw std::runtime_error("\"value\" must be a sequence (array)" + location);
+                }
+                VariableList list;
+                list.reserve(valueNode.size());
+                for (const auto& element : valueNode) {
+                    if (!element.IsScalar()) {
+                        throw std::runtime_error("List items must be scalars" + location);
+                    }
+                    list.push_back(element.as<std::string>());
+                }
+                variable->setList(std::move(list));
+            } else if (type == VariableType::vtMap) {
+                if (!valueNode.IsMap()) {
+                    throw std::runtime_error("\"value\" must be a map" + location);
+                }
+                VariableMap map;
+                map.reserve(valueNode.size());
+                for (const auto& element : valueNode) {
+                    if (!element.first.IsScalar() || !element.second.IsScalar()) {
+                        throw std::runtime_error("Map keys and values must be scalars" + location);
+                    }
+                    map.emplace_back(element.first.as<std::string>(), element.second.as<std::string>());
+                }
+                variable->setMap(std::move(map));
+            } else {
+                variable->setValue(valueNode.as<std::string>());
+            }
+        }
+
+        m_variableRefs.push_back(variable.get());
+        m_variables.push_back(std::move(variable));
+    }
+}
+
+void ParserYAML::loadPrompts() {
+    const YAML::Node promptsNode = m_document["prompts"];
+    if (!promptsNode.IsDefined()) {
+        return;  // No prompts section, list remains empty
+    }
+
+    if (!promptsNode.IsSequence()) {
+        throw std::runtime_error("\"prompts\" must be a sequence (array) in YAML.");
+    }
+
+    for (size_t i = 0; i < promptsNode.size(); ++i) {
+        const YAML::Node item = promptsNode[i];
+
+        auto prompt = std::make_unique<Prompt>(scalarOrEmpty(item["name"]));
+        prompt->setResult(scalarOrEmpty(item["result"]));
+
+        const YAML::Node inputsNode = item["inputs"];
+        if (inputsNode.IsDefined()) {
+            if (!inputsNode.IsSequence()) {
+                throw std::runtime_error("\"inputs\" must be a sequence (array) for prompt at index " +
+                                         std::to_string(i) + ".");
+            }
+
+            for (size_t j = 0; j < inputsNode.size(); ++j) {
+                const YAML::Node inputItem = inputsNode[j];
+                const std::string location = " at index " + std::to_string(j) +
+                                             " in prompt at index " + std::to_string(i) + ".";
+
+                auto promptInput = std::make_unique<PromptInput>();
+                promptInput->setInput(scalarOrEmpty(inputItem["input"]));
+
+                const std::string variableName = scalarOrEmpty(inputItem["variable"]);
+                Variable* variable = findVariable(variableName);
+                if (variable == nullptr) {
+                    throw std::runtime_error("Variable \"" + variableName + "\" not found for input" + location);
+                }
+                promptInput->setVariable(variable);
+
+                const std::string typeStr = scalarOrEmpty(inputItem["type"]);
+                try {
+                    promptInput->setType(PromptInput::stringToType(typeStr));
+                } catch (const std::invalid_argument&) {
+                    throw std::runtime_error("Unknown prompt input type \"" + typeStr + "\"" + location);
+                }
+
+                const YAML::Node optionsNode = inputItem["options"];
+                if (optionsNode.IsDefined() && !optionsNode.IsNull()) {
+                    if (!optionsNode.IsSequence()) {
+                        throw std::runtime_error("\"options\" must be a sequence (array) for input" + location);
+                    }
+                    for (const auto& option : optionsNode) {
+                        promptInput->addOption(scalarOrEmpty(option["name"]), scalarOrEmpty(option["value"]));
+                    }
+                }
+
+                prompt->addInput(std::move(promptInput));
+            }
+        }
+
+        m_prompts.push_back(std::move(prompt));
+    }
+}
+
+void ParserYAML::loadFiles() {
+    const YAML::Node filesNode = m_document["files"];
+    if (!filesNode.IsDefined() || !filesNode.IsSequence()) {
+        return;  // No files section, list remains empty
+    }
+
+    for (const auto& item : filesNode) {
+        auto file = std::make_unique<FileData>(scalarOrEmpty(item["path"]), scalarOrEmpty(item["content"]));
+
+        // Assign variables reference to file
+        file->setVariables(&m_variableRefs);
+
+        // Content may come from an asset file next to the template
+        if (item["source"].IsDefined()) {
+            file->setSource(scalarOrEmpty(item["source"]));
+            file->setContent(readSource(resolveSource(file->getSource())));
+        }
+
+        if (item["prompt"].IsDefined()) {
+            file->setPrompt(findPrompt(scalarOrEmpty(item["prompt"])));
+        }
+
+        loadEach(item, *file);
+
+        m_files.push_back(std::move(file));
+    }
+}
+
+void ParserYAML::loadFolders() {
+    const YAML::Node foldersNode = m_document["folders"];
+    if (!foldersNode.IsDefined() || !foldersNode.IsSequence()) {
+        return;  // No folders section, list remains empty
+    }
+
+    for (const auto& item : foldersNode) {
+        // Folders only need path, content is empty
+        auto folder = std::make_unique<FileData>(scalarOrEmpty(item["path"]), "");
+        folder->setVariables(&m_variableRefs);
+        loadEach(item, *folder);
+        m_folders.push_back(std::move(folder));
+    }
+}
+
+void ParserYAML::loadEach(const YAML::Node& item, FileData& entry) const {
+    if (!item["each"].IsDefined()) {
+        return;
+    }
+
+    const std::string each = scalarOrEmpty(item["each"]);
+    if (findVariable(each) == nullptr) {
+        throw std::runtime_error("Variable \"" + each + "\" used by each: not found for " + entry.getPath() + ".");
+    }
+    entry.setEach(each);
+
+    if (item["as"].IsDefined()) {
+        const std::string as = scalarOrEmpty(item["as"]);
+        if (as.empty()) {
+            throw std::runtime_error("\"as\" cannot be empty for " + entry.getPath() + ".");
+        }
+        entry.setEachAs(as);
+    }
+}
+
+void ParserYAML::buildAll() {
+    DirectorySink sink(std::filesystem::current_path());
+    buildAll(sink);
+}
+
+void ParserYAML::buildAll(OutputSink& sink, bool report) {
+    const EachExpander& expander = m_fileBuilder.getEachExpander();
+
+    for (const auto& file : m_files) {
+        if (file->hasPrompt()) {
+            m_fileBuilder.getPromptBuilder().collect(*file->getPrompt());
+        }
+        // each: entries stream one output at a time into the sink
+        expander.expand(*file, file->getVariables(), [&](const std::string& path, const std::vector<Variable*>* variables) {
+            sink.writeFile(path, m_fileBuilder.render(*file, variables));
+            if (report) {
+                std::cout << "Created file " << path << std::endl;
+            }
+        });
+    }
+
+    for (const auto& folder : m_folders) {
+        expander.expand(*folder, folder->getVariables(), [&](const std::string& path, const std::vector<Variable*>*) {
+            sink.createFolder(path);
+            if (report) {
+                std::cout << "Created folder " << path << std::endl;
+            }
+        });
+    }
+}
+
+size_t ParserYAML::reloadSource(const std::filesystem::path& source) {
+    size_t count = 0;
+    std::string content;
+    for (const auto& file : m_files) {
+        if (!file->hasSource() || resolveSource(file->getSource()) != source.lexically_normal()) {
+            continue;
+        }
+        if (count == 0) {
+            content = readTextFile(source);
+        }
+        file->setContent(content);
+        ++count;
+    }
+    return count;
+}
+
+Variable* ParserYAML::findVariable(const std::string& name) const {
+    for (const auto& variable : m_variables) {
+        if (sameText(variable->getName(), name)) {
+            return variable.get();
+        }
+    }
+    return nullptr;
+}
+
+Prompt* ParserYAML::findPrompt(const std::string& name) const {
+    for (const auto& prompt : m_prompts) {
+        if (sameText(prompt->getName(), name)) {
+            return prompt.get();
+        }
+    }
+    return nullptr;
+}
+
+std::vector<std::filesystem::path> ParserYAML::getSources() const {
+    std::vector<std::filesystem::path> sources;
+    for (const auto& file : m_files) {
+        if (file->hasSource()) {
+            sources.push_back(resolveSource(file->getSource()));
+        }
+    }
+    return sources;
+}
+
+std::string ParserYAML::readSource(const std::filesystem::path& source) const {
+    return m_sourceReader ? m_sourceReader(source) : readTextFile(source);
+}
+
+std::filesystem::path ParserYAML::resolveSource(const std::string& source) const {
+    const std::filesystem::path sourcePath(source);
+    if (sourcePath.is_absolute()) {
+        return sourcePath.lexically_normal();
+    }
+    return (m_baseDirectory / sourcePath).lexically_normal();
+}
+
+} // namespace TemplateBuilder
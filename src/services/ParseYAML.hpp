@@ -0,0 +1,99 @@
+#pragma once
+
+#include <stdexcept>
+#include <string>
+#include <vector>
+#include <memory>
+#include <filesystem>
+#include <functional>
+#include <yaml-cpp/yaml.h>
+#include "builders/FileBuilder.hpp"
+#include "builders/FolderBuilder.hpp"
+#include "builders/OutputSink.hpp"
+#include "types/FileType.hpp"
+#include "types/PromptType.hpp"
+#include "types/VariableType.hpp"
+
+namespace TemplateBuilder {
+
+class UnsupportedTemplateVersion : public std::runtime_error {
+public:
+    using std::runtime_error::runtime_error;
+};
+
+class ParserYAML {
+public:
+    // Reads a source asset; lets callers share file contents between templates
+    using SourceReader = std::function<std::string(const std::filesystem::path&)>;
+
+    // Constructors
+    explicit ParserYAML(const std::string& fileName);
+    ParserYAML(const std::string& fileName, const PromptBuilder& promptBuilder);
+    ParserYAML(const std::string& fileName, const PromptBuilder& promptBuilder, SourceReader sourceReader);
+
+    // Parses a template held in memory; source assets resolve against baseDirectory
+    [[nodiscard]] static std::unique_ptr<ParserYAML> fromString(const std::string& yaml,
+                                                                const std::filesystem::path& baseDirectory,
+                                                                const PromptBuilder& promptBuilder = PromptBuilder());
+
+    ParserYAML(const ParserYAML&) = delete;
+    ParserYAML& operator=(const ParserYAML&) = delete;
+
+    // Runs prompts and writes every file and folder. Without report nothing
+    // is printed, for sinks that only queue output until they are flushed
+    void buildAll();
+    void buildAll(OutputSink& sink, bool report = true);
+
+    // Re-reads the content of files loaded from the given source asset
+    // Returns the number of files that reference it
+    size_t reloadSource(const std::filesystem::path& source);
+
+    // Getters
+    [[nodiscard]] const std::string& getVersion() const noexcept { return m_version; }
+    [[nodiscard]] const std::filesystem::path& getFileName() const noexcept { return m_fileName; }
+    [[nodiscard]] const std::filesystem::path& getBaseDirectory() const noexcept { return m_baseDirectory; }
+    [[nodiscard]] const YAML::Node& getDocument() const noexcept { return m_document; }
+    [[nodiscard]] const std::vector<std::unique_ptr<FileData>>& getFiles() const noexcept { return m_files; }
+    [[nodiscard]] const std::vector<std::unique_ptr<FileData>>& getFolders() const noexcept { return m_folders; }
+    [[nodiscard]] const std::vector<std::unique_ptr<Variable>>& getVariables() const noexcept { return m_variables; }
+    [[nodiscard]] const std::vector<std::unique_ptr<Prompt>>& getPrompts() const noexcept { return m_prompts; }
+    [[nodiscard]] FileBuilder& getFileBuilder() noexcept { return m_fileBuilder; }
+    [[nodiscard]] const FileBuilder& getFileBuilder() const noexcept { return m_fileBuilder; }
+    [[nodiscard]] const FolderBuilder& getFolderBuilder() const noexcept { return m_folderBuilder; }
+
+    // Lookup helpers (case-insensitive, like the template syntax)
+    [[nodiscard]] Variable* findVariable(const std::string& name) const;
+    [[nodiscard]] Prompt* findPrompt(const std::string& name) const;
+
+    // Source assets referenced by files, resolved against the template directory
+    [[nodiscard]] std::vector<std::filesystem::path> getSources() const;
+
+private:
+    ParserYAML(const YAML::Node& document, const std::filesystem::path& baseDirectory,
+               const PromptBuilder& promptBuilder);
+
+    void load();
+    void validateVersion();
+    void loadVariables();
+    void loadPrompts();
+    void loadFiles();
+    void loadFolders();
+    void loadEach(const YAML::Node& item, FileData& entry) const;
+    [[nodiscard]] std::filesystem::path resolveSource(const std::string& source) const;
+    [[nodiscard]] std::string readSource(const std::filesystem::path& source) const;
+
+    std::filesystem::path m_fileName;
+    std::filesystem::path m_baseDirectory;
+    std::string m_version;
+    YAML::Node m_document;
+    std::vector<std::unique_ptr<FileData>> m_files;
+    std::vector<std::unique_ptr<FileData>> m_folders;
+    std::vector<std::unique_ptr<Variable>> m_variables;
+    std::vector<Variable*> m_variableRefs;  // Non-owning view shared with every FileData
+    std::vector<std::unique_ptr<Prompt>> m_prompts;
+    FileBuilder m_fileBuilder;
+    FolderBuilder m_folderBuilder;
+    SourceReader m_sourceReader;
+};
+
+} // namespace TemplateBuilder
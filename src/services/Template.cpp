@@ -0,0 +1,138 @@
+#include "services/Template.hpp"
+#include "services/ParseYAML.hpp"
+#include <algorithm>
+#include <cctype>
+#include <stdexcept>
+
+namespace TemplateBuilder {
+
+namespace {
+
+bool sameText(const std::string& left, const std::string& right) {
+    return left.size() == right.size() &&
+           std::equal(left.begin(), left.end(), right.begin(), [](unsigned char a, unsigned char b) {
+               return std::tolower(a) == std::tolower(b);
+           });
+}
+
+// Text is accepted for any type (a list variable splits it into lines);
+// list and map values must match the declared type
+void assign(Variable& variable, const Template::Value& value) {
+    if (const auto* text = std::get_if<std::string>(&value)) {
+        variable.setValue(*text);
+    } else if (const auto* list = std::get_if<VariableList>(&value)) {
+        if (variable.getType() != VariableType::vtList) {
+            throw std::invalid_argument("Variable \"" + variable.getName() + "\" does not accept a list value");
+        }
+        variable.setList(*list);
+    } else {
+        if (variable.getType() != VariableType::vtMap) {
+            throw std::invalid_argument("Variable \"" + variable.getName() + "\" does not accept a map value");
+        }
+        variable.setMap(std::get<VariableMap>(value));
+    }
+}
+
+} // namespace
+
+Template::Template(std::shared_ptr<const ParserYAML> parser)
+    : m_parser(std::move(parser)) {
+}
+
+Template Template::loadFile(const std::string& fileName, const SourceReader& sourceReader) {
+    return Template(std::make_shared<const ParserYAML>(fileName, PromptBuilder(), sourceReader));
+}
+
+Template Template::loadString(const std::string& yaml, const std::filesystem::path& baseDirectory) {
+    return Template(ParserYAML::fromString(yaml, baseDirectory));
+}
+
+std::vector<Variable> Template::resolveVariables(const Variables& variables) const {
+    // Private copy of the variables for this render only
+    std::vector<Variable> values;
+    values.reserve(m_parser->getVariables().size());
+    for (const auto& variable : m_parser->getVariables()) {
+        values.push_back(*variable);
+    }
+
+    for (const auto& [name, value] : variables) {
+        const auto found = std::find_if(values.begin(), values.end(),
+                                        [&name](const Variable& variable) { return sameText(variable.getName(), name); });
+        if (found == values.end()) {
+            throw std::invalid_argument("Unknown variable: " + name);
+        }
+        assign(*found, value);
+    }
+    return values;
+}
+
+void Template::render(OutputSink& sink, const Variables& variables) const {
+    std::vector<Variable> values = resolveVariables(variables);
+    std::vector<Variable*> refs;
+    refs.reserve(values.size());
+    for (auto& variable : values) {
+        refs.push_back(&variable);
+    }
+
+    const FileBuilder& fileBuilder = m_parser->getFileBuilder();
+    const EachExpander& expander = fileBuilder.getEachExpander();
+    for (const auto& file : m_parser->getFiles()) {
+        expander.expand(*file, &refs, [&](const std::string& path, const std::vector<Variable*>* scope) {
+            sink.writeFile(path, fileBuilder.render(*file, scope));
+        });
+    }
+
+    for (const auto& folder : m_parser->getFolders()) {
+        expander.expand(*folder, &refs, [&](const std::string& path, const std::vector<Variable*>*) {
+            sink.createFolder(path);
+        });
+    }
+}
+
+std::map<std::string, std::string> Template::render(const Variables& variables) const {
+    MemorySink sink;
+    render(sink, variables);
+    return sink.getFiles();
+}
+
+std::vector<std::string> Template::getOutputPaths(const Variables& variables) const {
+    return expandPaths(m_parser->getFiles(), variables);
+}
+
+std::vector<std::string> Template::getOutputFolders(const Variables& variables) const {
+    return expandPaths(m_parser->getFolders(), variables);
+}
+
+std::vector<std::string> Template::expandPaths(const std::vector<std::unique_ptr<FileData>>& entries,
+                                               const Variables& variables) const {
+    std::vector<Variable> values = resolveVariables(variables);
+    std::vector<Variable*> refs;
+    refs.reserve(values.size());
+    for (auto& variable : values) {
+        refs.push_back(&variable);
+    }
+
+    // Expanding each: yields the paths without rendering any content
+    std::vector<std::string> paths;
+    const EachExpander& expander = m_parser->getFileBuilder().getEachExpander();
+    for (const auto& entry : entries) {
+        expander.expand(*entry, &refs, [&paths](const std::string& path, const std::vector<Variable*>*) {
+            paths.push_back(path);
+        });
+    }
+    return paths;
+}
+
+const std::string& Template::getVersion() const noexcept {
+    return m_parser->getVersion();
+}
+
+std::vector<std::string> Template::getVariableNames() const {
+    std::vector<std::string> names;
+    for (const auto& variable : m_parser->getVariables()) {
+        names.push_back(variable->getName());
+    }
+    return names;
+}
+
+} // namespace TemplateBuilder
@@ -0,0 +1,56 @@
+#pragma once
+
+#include <filesystem>
+#include <functional>
+#include <map>
+#include <memory>
+#include <string>
+#include <variant>
+#include <vector>
+#include "builders/OutputSink.hpp"
+#include "types/VariableType.hpp"
+
+namespace TemplateBuilder {
+
+class FileData;
+class ParserYAML;
+
+// In-process rendering API. A loaded Template is immutable: every render
+// works on its own copy of the variables, so one instance can be rendered
+// from several threads at once. Prompts are not run; callers supply values.
+class Template {
+public:
+    // Override for one variable: text, or the items of a list / map variable
+    using Value = std::variant<std::string, VariableList, VariableMap>;
+    using Variables = std::map<std::string, Value>;
+    using SourceReader = std::function<std::string(const std::filesystem::path&)>;
+
+    // Loaders
+    [[nodiscard]] static Template loadFile(const std::string& fileName,
+                                           const SourceReader& sourceReader = {});
+    [[nodiscard]] static Template loadString(const std::string& yaml,
+                                             const std::filesystem::path& baseDirectory = std::filesystem::current_path());
+
+    // Renders every file and folder; values override the template defaults
+    void render(OutputSink& sink, const Variables& variables = {}) const;
+    [[nodiscard]] std::map<std::string, std::string> render(const Variables& variables = {}) const;
+
+    // Paths of the files / folders a render would write, without rendering content
+    [[nodiscard]] std::vector<std::string> getOutputPaths(const Variables& variables = {}) const;
+    [[nodiscard]] std::vector<std::string> getOutputFolders(const Variables& variables = {}) const;
+
+    // Getters
+    [[nodiscard]] const std::string& getVersion() const noexcept;
+    [[nodiscard]] std::vector<std::string> getVariableNames() const;
+
+private:
+    explicit Template(std::shared_ptr<const ParserYAML> parser);
+
+    [[nodiscard]] std::vector<Variable> resolveVariables(const Variables& variables) const;
+    [[nodiscard]] std::vector<std::string> expandPaths(const std::vector<std::unique_ptr<FileData>>& entries,
+                                                       const Variables& variables) const;
+
+    std::shared_ptr<const ParserYAML> m_parser;
+};
+
+} // namespace TemplateBuilder
@@ -0,0 +1,63 @@
+#include "services/TemplateCache.hpp"
+#include <fstream>
+#include <sstream>
+#include <stdexcept>
+
+namespace TemplateBuilder {
+
+TemplateCache::TemplateCache()
+    : m_directories(std::make_shared<DirectoryCache>()) {
+}
+
+Template TemplateCache::load(const std::string& fileName) {
+    const std::string key = std::filesystem::weakly_canonical(fileName).string();
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        const auto found = m_templates.find(key);
+        if (found != m_templates.end()) {
+            return found->second;
+        }
+    }
+
+    // Parsed outside the lock so distinct templates load in parallel; if two
+    // workers race on the same file the first one stored wins
+    Template loaded = Template::loadFile(fileName, [this](const std::filesystem::path& path) {
+        return readSource(path);
+    });
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_templates.emplace(key, std::move(loaded)).first->second;
+}
+
+std::string TemplateCache::readSource(const std::filesystem::path& path) {
+    const std::string key = path.lexically_normal().string();
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        const auto found = m_sources.find(key);
+        if (found != m_sources.end()) {
+            return found->second;
+        }
+    }
+
+    std::ifstream stream(path, std::ios::binary);
+    if (!stream) {
+        throw std::runtime_error("Source file not found: " + path.string());
+    }
+    std::ostringstream content;
+    content << stream.rdbuf();
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_sources.emplace(key, content.str()).first->second;
+}
+
+size_t TemplateCache::getTemplateCount() const {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_templates.size();
+}
+
+size_t TemplateCache::getSourceCount() const {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_sources.size();
+}
+
+} // namespace TemplateBuilder
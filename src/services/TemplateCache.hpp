@@ -0,0 +1,38 @@
+#pragma once
+
+#include <filesystem>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include "builders/OutputSink.hpp"
+#include "services/Template.hpp"
+
+namespace TemplateBuilder {
+
+// Caches shared by every template of a batch: parsed templates by canonical
+// path, source asset contents, and the set of directories already created.
+// All members are safe to use from several threads.
+class TemplateCache {
+public:
+    TemplateCache();
+
+    // Parses a template once; later calls for the same file reuse it
+    [[nodiscard]] Template load(const std::string& fileName);
+
+    // Reads a source asset once for the whole batch
+    [[nodiscard]] std::string readSource(const std::filesystem::path& path);
+
+    // Getters
+    [[nodiscard]] const std::shared_ptr<DirectoryCache>& getDirectories() const noexcept { return m_directories; }
+    [[nodiscard]] size_t getTemplateCount() const;
+    [[nodiscard]] size_t getSourceCount() const;
+
+private:
+    mutable std::mutex m_mutex;
+    std::unordered_map<std::string, Template> m_templates;
+    std::unordered_map<std::string, std::string> m_sources;
+    std::shared_ptr<DirectoryCache> m_directories;
+};
+
+} // namespace TemplateBuilder
@@ -0,0 +1,267 @@
+#include "services/TemplateWatcher.hpp"
+#include <algorithm>
+#include <cctype>
+#include <chrono>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <set>
+#include <stdexcept>
+#include <unordered_set>
+
+#ifdef __linux__
+#include <poll.h>
+#include <sys/inotify.h>
+#include <unistd.h>
+#include <cerrno>
+#include <cstring>
+#endif
+
+namespace TemplateBuilder {
+
+namespace {
+
+// Quiet period used to coalesce the burst of events an editor save produces
+constexpr int DEBOUNCE_MILLISECONDS = 5;
+
+std::string toLower(std::string value) {
+    std::transform(value.begin(), value.end(), value.begin(),
+                   [](unsigned char c) { return static_cast<char>(std::tolower(c)); });
+    return value;
+}
+
+size_t inputHash(const FileData& file) {
+    // each:/as: retarget the outputs and source: names the asset, so they
+    // are inputs of the declaration just like its content
+    std::string key = file.hasPrompt() ? file.getPrompt()->getResult() : file.getContent();
+    for (const std::string* field : {&file.getSource(), &file.getEach(), &file.getEachAs()}) {
+        key += '\0';
+        key += *field;
+    }
+    if (file.hasVariables()) {
+        for (const auto* variable : *file.getVariables()) {
+            key += '\0';
+            key += variable->getName();
+            key += '=';
+            key += variable->getText();
+        }
+    }
+    return std::hash<std::string>{}(key) | 1;  // Never 0, which marks "not rendered"
+}
+
+} // namespace
+
+TemplateWatcher::TemplateWatcher(const std::string& fileName)
+    : TemplateWatcher(fileName, PromptBuilder()) {
+}
+
+TemplateWatcher::TemplateWatcher(const std::string& fileName, const PromptBuilder& promptBuilder)
+    : m_fileName(std::filesystem::absolute(fileName).lexically_normal()),
+      m_promptBuilder(promptBuilder),
+      m_parser(std::make_unique<ParserYAML>(m_fileName.string(), promptBuilder)) {
+}
+
+void TemplateWatcher::build() {
+    collectMissingAnswers();
+    renderChanged();
+
+    for (const auto& folder : m_parser->getFolders()) {
+        m_parser->getFolderBuilder().build(*folder);
+        std::cout << "Created folder " << folder->getPath() << std::endl;
+    }
+}
+
+size_t TemplateWatcher::refresh(const std::vector<std::filesystem::path>& changed) {
+    bool templateChanged = false;
+    for (const auto& path : changed) {
+        if (std::filesystem::absolute(path).lexically_normal() == m_fileName) {
+            templateChanged = true;
+            break;
+        }
+    }
+
+    if (templateChanged) {
+        // Re-parsing also re-reads every source asset
+        reloadTemplate();
+        for (const auto& folder : m_parser->getFolders()) {
+            m_parser->getFolderBuilder().build(*folder);
+        }
+    } else {
+        for (const auto& path : changed) {
+            m_parser->reloadSource(std::filesystem::absolute(path).lexically_normal());
+        }
+    }
+
+    return renderChanged();
+}
+
+std::vector<std::filesystem::path> TemplateWatcher::getWatchedFiles() const {
+    std::vector<std::filesystem::path> files = {m_fileName};
+    for (const auto& source : m_parser->getSources()) {
+        if (std::find(files.begin(), files.end(), source) == files.end()) {
+            files.push_back(source);
+        }
+    }
+    return files;
+}
+
+void TemplateWatcher::reloadTemplate() {
+    // Parse into a new model first so a half-saved template keeps the old one
+    auto parser = std::make_unique<ParserYAML>(m_fileName.string(), m_promptBuilder);
+    m_parser = std::move(parser);
+    collectMissingAnswers();
+}
+
+void TemplateWatcher::collectMissingAnswers() {
+    std::unordered_set<const Prompt*> visited;
+    for (const auto& file : m_parser->getFiles()) {
+        Prompt* prompt = file->getPrompt();
+        if (prompt == nullptr || !visited.insert(prompt).second) {
+            continue;
+        }
+
+        for (auto& promptInput : prompt->getInputs()) {
+            Variable* variable = promptInput->getVariable();
+            const std::string key = toLower(variable->getName());
+            const auto answer = m_answers.find(key);
+            if (answer != m_answers.end()) {
+                variable->setValue(answer->second);
+            } else {
+                m_promptBuilder.collectInput(*promptInput);
+                m_answers[key] = variable->getValue();
+            }
+        }
+    }
+}
+
+size_t TemplateWatcher::renderChanged() {
+    size_t written = 0;
+    const FileBuilder& fileBuilder = m_parser->getFileBuilder();
+
+    for (const auto& file : m_parser->getFiles()) {
+        // Declarations are keyed by their raw path so an each: entry is
+        // skipped as a whole when none of its inputs changed
+        size_t& declarationHash = m_inputs[file->getPath()];
+        const size_t hash = inputHash(*file);
+        if (declarationHash == hash) {
+            continue;
+        }
+        declarationHash = hash;
+
+        fileBuilder.getEachExpander().expand(*file, file->getVariables(), [&](const std::string& path, const std::vector<Variable*>* variables) {
+            const std::string content = fileBuilder.render(*file, variables);
+            const size_t contentHash = std::hash<std::string>{}(content) | 1;  // Never 0, which marks "not written"
+            size_t& outputHash = m_outputs[path];
+            if (outputHash == contentHash) {
+                return;
+            }
+
+            FileBuilder::write(path, content);
+            outputHash = contentHash;
+            std::cout << "Created file " << path << std::endl;
+            ++written;
+        });
+    }
+
+    return written;
+}
+
+#ifdef __linux__
+
+void TemplateWatcher::run() {
+    const int fd = inotify_init1(IN_CLOEXEC);
+    if (fd < 0) {
+        throw std::runtime_error(std::string("Unable to initialize inotify: ") + std::strerror(errno));
+    }
+
+    // Watch parent directories rather than the files themselves: editors
+    // commonly save by writing a temporary file and renaming it over the original
+    std::unordered_map<int, std::filesystem::path> directories;
+    std::set<std::filesystem::path> watched;
+    const auto updateWatches = [&]() {
+        watched.clear();
+        for (const auto& file : getWatchedFiles()) {
+            watched.insert(file);
+            const std::filesystem::path directory = file.parent_path();
+            const int wd = inotify_add_watch(fd, directory.c_str(), IN_CLOSE_WRITE | IN_MOVED_TO | IN_CREATE);
+            if (wd >= 0) {
+                directories[wd] = directory;
+            }
+        }
+    };
+    updateWatches();
+
+    std::cout << "Watching " << watched.size() << " file(s) for changes. Press Ctrl+C to stop." << std::endl;
+
+    alignas(inotify_event) char buffer[16 * 1024];
+    while (true) {
+        std::set<std::filesystem::path> changed;
+        std::chrono::steady_clock::time_point editTime;
+
+        // Block for the first event, then drain until the burst settles
+        int timeout = -1;
+        while (true) {
+            pollfd descriptor = {fd, POLLIN, 0};
+            const int ready = poll(&descriptor, 1, timeout);
+            if (ready < 0 && errno == EINTR) {
+                continue;
+            }
+            if (ready <= 0) {
+                break;
+            }
+
+            const ssize_t length = read(fd, buffer, sizeof(buffer));
+            if (length <= 0) {
+                break;
+            }
+            if (timeout < 0) {
+                editTime = std::chrono::steady_clock::now();
+            }
+
+            for (ssize_t offset = 0; offset < length;) {
+                const auto* event = reinterpret_cast<const inotify_event*>(buffer + offset);
+                offset += static_cast<ssize_t>(sizeof(inotify_event) + event->len);
+
+                const auto directory = directories.find(event->wd);
+                if (directory == directories.end() || event->len == 0) {
+                    continue;
+                }
+                const std::filesystem::path path = directory->second / event->name;
+                if (watched.count(path) != 0) {
+                    changed.insert(path);
+                }
+            }
+
+            if (!changed.empty()) {
+                timeout = DEBOUNCE_MILLISECONDS;
+            }
+        }
+
+        if (changed.empty()) {
+            continue;
+        }
+
+        try {
+            const size_t written = refresh({changed.begin(), changed.end()});
+            updateWatches();
+
+            const auto elapsed = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - editTime);
+            std::cout << "Rebuilt " << written << " file(s) in " << std::fixed << std::setprecision(2)
+                      << elapsed.count() << " ms" << std::endl;
+        } catch (const YAML::Exception& e) {
+            std::cerr << "Error parsing YAML: " << e.what() << std::endl;
+        } catch (const std::exception& e) {
+            std::cerr << "Error: " << e.what() << std::endl;
+        }
+    }
+}
+
+#else
+
+void TemplateWatcher::run() {
+    throw std::runtime_error("Watch mode is only supported on Linux.");
+}
+
+#endif
+
+} // namespace TemplateBuilder
@@ -0,0 +1,47 @@
+#pragma once
+
+#include <filesystem>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+#include "builders/PromptBuilder.hpp"
+#include "services/ParseYAML.hpp"
+
+namespace TemplateBuilder {
+
+// Keeps a parsed template in memory and re-renders only the outputs whose
+// inputs changed when the template or one of its source assets is edited.
+class TemplateWatcher {
+public:
+    // Constructors
+    explicit TemplateWatcher(const std::string& fileName);
+    TemplateWatcher(const std::string& fileName, const PromptBuilder& promptBuilder);
+
+    // Runs every prompt once and writes all files and folders
+    void build();
+
+    // Applies a batch of changed paths; returns the number of files rewritten
+    size_t refresh(const std::vector<std::filesystem::path>& changed);
+
+    // Blocks, watching the template and its sources (Linux inotify)
+    void run();
+
+    // Getters
+    [[nodiscard]] const ParserYAML& getParser() const noexcept { return *m_parser; }
+    [[nodiscard]] std::vector<std::filesystem::path> getWatchedFiles() const;
+
+private:
+    void reloadTemplate();
+    void collectMissingAnswers();
+    size_t renderChanged();
+
+    std::filesystem::path m_fileName;
+    PromptBuilder m_promptBuilder;
+    std::unique_ptr<ParserYAML> m_parser;
+    std::unordered_map<std::string, std::string> m_answers;  // Prompted values by lower-case variable name
+    std::unordered_map<std::string, size_t> m_inputs;   // Input hash by declared path
+    std::unordered_map<std::string, size_t> m_outputs;  // Content hash by rendered path
+};
+
+} // namespace TemplateBuilder
@@ -1,42 +1,72 @@
 #include <iostream>
 #include <fstream>
 #include <string>
+#include <vector>
+#include <chrono>
 #include <filesystem>
+#include <iomanip>
 #include <yaml-cpp/yaml.h>
+#include "builders/DurableSink.hpp"
+#include "builders/UringSink.hpp"
+#include "services/BatchRunner.hpp"
+#include "services/ParseYAML.hpp"
+#include "services/TemplateWatcher.hpp"
 
-void showUsage(const char* programName) {
-    std::cout << "Usage: " << programName << " <arquivo.yaml>" << std::endl;
-}
-
-void printVariables(const YAML::Node& variablesNode) {
-    if (!variablesNode.IsDefined() || !variablesNode.IsSequence()) {
-        std::cout << "No variables found or variables is not a sequence." << std::endl;
-        return;
-    }
+using namespace TemplateBuilder;
 
-    std::cout << "Variables:" << std::endl;
-    std::cout << "----------" << std::endl;
+// Upper bound for --jobs; more threads than this only cost memory
+constexpr size_t MAX_JOBS = 1024;
 
-    for (const auto& variable : variablesNode) {
-        if (!variable.IsMap()) {
-            continue;
-        }
+// Parses a --jobs value: digits only, between 1 and MAX_JOBS; 0 when invalid
+size_t parseJobs(const std::string& value) {
+    if (value.empty() || value.size() > 4 || value.find_first_not_of("0123456789") != std::string::npos) {
+        return 0;
+    }
+    const size_t jobs = std::stoul(value);
+    return jobs <= MAX_JOBS ? jobs : 0;
+}
 
-        std::string name;
-        std::string type;
+void showUsage(const char* programName) {
+    std::cout << "Usage: " << programName << " [--watch | --durable <dir> | --io-uring] <arquivo.yaml>" << std::endl;
+    std::cout << "       " << programName << " [--jobs <n>] [--io-uring] <arquivo.yaml | dir | @manifest>..." << std::endl;
+    std::cout << std::endl;
+    std::cout << "Options:" << std::endl;
+    std::cout << "  --watch          Keep running and re-render outputs when the template or its sources change" << std::endl;
+    std::cout << "  --durable <dir>  Generate into <dir> all-or-nothing: stage, sync once and publish atomically" << std::endl;
+    std::cout << "  --jobs <n>       Templates rendered concurrently in batch mode (1-1024, default: CPU count)" << std::endl;
+    std::cout << "  --io-uring       Write files in batches through Linux io_uring (plain writes where unavailable)" << std::endl;
+    std::cout << std::endl;
+    std::cout << "Several templates, a directory or a @manifest (one path per line) run as one batch" << std::endl;
+    std::cout << "using the default variable values; a failing template does not stop the others." << std::endl;
+}
 
-        if (variable["name"].IsDefined()) {
-            name = variable["name"].as<std::string>();
+int runBatch(const std::vector<std::string>& arguments, size_t jobs, bool ioUring) {
+    const auto start = std::chrono::steady_clock::now();
+
+    BatchRunner runner = jobs > 0 ? BatchRunner(jobs) : BatchRunner();
+    runner.setIoUring(ioUring);
+    const std::vector<std::string> templates = BatchRunner::collectTemplates(arguments);
+    const std::vector<BatchResult> results = runner.run(templates, std::filesystem::current_path());
+
+    size_t failed = 0;
+    for (const auto& result : results) {
+        if (result.success) {
+            std::cout << "[OK]     " << result.templatePath << " (" << result.files << " file(s), "
+                      << std::fixed << std::setprecision(2) << result.milliseconds << " ms)" << std::endl;
+        } else {
+            std::cout << "[FAILED] " << result.templatePath << ": " << result.error << std::endl;
+            ++failed;
         }
+    }
 
-        if (variable["type"].IsDefined()) {
-            type = variable["type"].as<std::string>();
-        }
+    const auto elapsed = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start);
+    std::cout << std::endl;
+    std::cout << (results.size() - failed) << " template(s) succeeded, " << failed << " failed in "
+              << std::fixed << std::setprecision(2) << elapsed.count() << " ms using "
+              << runner.getThreadCount() << " thread(s)" << std::endl;
+    std::cout << std::endl;
 
-        if (!name.empty() && !type.empty()) {
-            std::cout << "Name: " << name << " | Type: " << type << std::endl;
-        }
-    }
+    return failed == 0 ? 0 : 1;
 }
 
 int main(int argc, char* argv[]) {
@@ -47,13 +77,57 @@ int main(int argc, char* argv[]) {
     std::cout << "***************************************************" << std::endl;
     std::cout << std::endl;
 
+    bool watch = false;
+    bool ioUring = false;
+    std::string durableDirectory;
+    size_t jobs = 0;
+    std::vector<std::string> paths;
+    for (int i = 1; i < argc; ++i) {
+        const std::string argument = argv[i];
+        if (argument == "--watch") {
+            watch = true;
+        } else if (argument == "--io-uring") {
+            ioUring = true;
+        } else if ((argument == "--durable" || argument == "--jobs") && i + 1 == argc) {
+            // Option given without its value
+            showUsage(argv[0]);
+            return 1;
+        } else if (argument == "--durable") {
+            durableDirectory = argv[++i];
+        } else if (argument == "--jobs") {
+            jobs = parseJobs(argv[++i]);
+            if (jobs == 0) {
+                showUsage(argv[0]);
+                return 1;
+            }
+        } else {
+            paths.push_back(argument);
+        }
+    }
+
     // Check if YAML file path was provided
-    if (argc < 2) {
+    const bool durable = !durableDirectory.empty();
+    if (paths.empty() || paths[0].empty() || (watch && durable) || (ioUring && (watch || durable))) {
         showUsage(argv[0]);
         return 1;
     }
 
-    std::string yamlFilePath = argv[1];
+    // Several templates, a directory or a manifest run as one batch
+    const bool batch = paths.size() > 1 || paths[0].front() == '@' || std::filesystem::is_directory(paths[0]);
+    if (batch) {
+        if (watch || durable) {
+            showUsage(argv[0]);
+            return 1;
+        }
+        try {
+            return runBatch(paths, jobs, ioUring);
+        } catch (const std::exception& e) {
+            std::cerr << "Error: " << e.what() << std::endl;
+            return 1;
+        }
+    }
+
+    const std::string yamlFilePath = paths[0];
 
     // Check if file exists
     if (!std::filesystem::exists(yamlFilePath)) {
@@ -62,20 +136,40 @@ int main(int argc, char* argv[]) {
     }
 
     try {
-        // Load YAML file
-        YAML::Node config = YAML::LoadFile(yamlFilePath);
-
-        // Check if variables section exists
-        if (!config["variables"].IsDefined()) {
-            std::cout << "No 'variables' section found in YAML file." << std::endl;
+        if (watch) {
+            TemplateWatcher watcher(yamlFilePath);
+            watcher.build();
+            std::cout << std::endl;
+            watcher.run();
             return 0;
         }
 
-        // Print variables
-        printVariables(config["variables"]);
+        ParserYAML parser(yamlFilePath);
+        if (durable) {
+            DurableSink sink(durableDirectory);
+            parser.buildAll(sink);
+            const DurableStats stats = sink.commit();
+
+            std::cout << std::endl;
+            std::cout << "Published " << stats.files << " file(s) to " << sink.getTarget().string()
+                      << (stats.exchanged ? " (exchanged)" : "") << std::endl;
+            std::cout << "Durability added " << std::fixed << std::setprecision(2)
+                      << stats.syncMilliseconds + stats.publishMilliseconds << " ms (sync "
+                      << stats.syncMilliseconds << " ms, publish " << stats.publishMilliseconds << " ms)" << std::endl;
+        } else if (ioUring) {
+            // Files are only queued while building; report them once written
+            UringSink sink(std::filesystem::current_path());
+            parser.buildAll(sink, false);
+            sink.flush();
+            std::cout << "Created " << sink.getFilesWritten() << " file(s)"
+                      << (sink.isUringActive() ? " through io_uring" : " with plain writes (io_uring unavailable)")
+                      << std::endl;
+        } else {
+            parser.buildAll();
+        }
 
         std::cout << std::endl;
-        std::cout << "Template Builder execution completed successfully." << std::endl;
+        std::cout << "Template successfully generated." << std::endl;
         std::cout << std::endl;
 
     } catch (const YAML::Exception& e) {
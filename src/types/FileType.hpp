@@ -17,23 +17,34 @@ public:
     // Getters
     [[nodiscard]] const std::string& getPath() const noexcept { return m_path; }
     [[nodiscard]] const std::string& getContent() const noexcept { return m_content; }
+    [[nodiscard]] const std::string& getSource() const noexcept { return m_source; }
+    [[nodiscard]] const std::string& getEach() const noexcept { return m_each; }
+    [[nodiscard]] const std::string& getEachAs() const noexcept { return m_eachAs; }
     [[nodiscard]] Prompt* getPrompt() const noexcept { return m_prompt; }
     [[nodiscard]] const std::vector<Variable*>* getVariables() const noexcept { return m_variables; }
 
     // Setters
     void setPath(const std::string& path) { m_path = path; }
     void setContent(const std::string& content) { m_content = content; }
+    void setSource(const std::string& source) { m_source = source; }
+    void setEach(const std::string& each) { m_each = each; }
+    void setEachAs(const std::string& eachAs) { m_eachAs = eachAs; }
     void setPrompt(Prompt* prompt) { m_prompt = prompt; }
     void setVariables(const std::vector<Variable*>* variables) { m_variables = variables; }
 
     // Utility methods
     [[nodiscard]] bool hasPrompt() const noexcept { return m_prompt != nullptr; }
     [[nodiscard]] bool hasVariables() const noexcept { return m_variables != nullptr; }
+    [[nodiscard]] bool hasSource() const noexcept { return !m_source.empty(); }
+    [[nodiscard]] bool hasEach() const noexcept { return !m_each.empty(); }
     [[nodiscard]] bool isEmpty() const noexcept { return m_path.empty() && m_content.empty(); }
 
 private:
     std::string m_path;
     std::string m_content;
+    std::string m_source;  // Asset file the content was loaded from, if any
+    std::string m_each;    // List/map variable this entry fans out over, if any
+    std::string m_eachAs = "item";  // Name bound to the current element
     Prompt* m_prompt = nullptr;  // Non-owning pointer
     const std::vector<Variable*>* m_variables = nullptr;  // Non-owning pointer to shared vector
 };
@@ -13,10 +13,45 @@ Variable::Variable(const std::string& name, VariableType type, const std::string
 }
 
 const std::string& Variable::getValue() const {
-    if (!m_value.has_value()) {
+    if (!hasValue()) {
         throw std::runtime_error("Variable value not set");
     }
-    return m_value.value();
+    if (const auto* value = std::get_if<std::string>(&m_value)) {
+        return *value;
+    }
+    throw std::runtime_error("Variable value is not a string: " + m_name);
+}
+
+const VariableList& Variable::getList() const {
+    if (const auto* list = std::get_if<VariableList>(&m_value)) {
+        return *list;
+    }
+    throw std::runtime_error("Variable value is not a list: " + m_name);
+}
+
+const VariableMap& Variable::getMap() const {
+    if (const auto* map = std::get_if<VariableMap>(&m_value)) {
+        return *map;
+    }
+    throw std::runtime_error("Variable value is not a map: " + m_name);
+}
+
+std::string Variable::getText() const {
+    if (const auto* value = std::get_if<std::string>(&m_value)) {
+        return *value;
+    }
+
+    std::string text;
+    if (const auto* list = std::get_if<VariableList>(&m_value)) {
+        for (const auto& item : *list) {
+            text += item + '\n';
+        }
+    } else if (const auto* map = std::get_if<VariableMap>(&m_value)) {
+        for (const auto& [key, value] : *map) {
+            text += key + ": " + value + '\n';
+        }
+    }
+    return text;
 }
 
 VariableType Variable::stringToType(const std::string& typeStr) {
@@ -25,6 +60,10 @@ VariableType Variable::stringToType(const std::string& typeStr) {
 
     if (lowerTypeStr == "string") {
         return VariableType::vtString;
+    } else if (lowerTypeStr == "list") {
+        return VariableType::vtList;
+    } else if (lowerTypeStr == "map") {
+        return VariableType::vtMap;
     }
 
     throw std::invalid_argument("Unknown variable type: " + typeStr);
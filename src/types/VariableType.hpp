@@ -1,15 +1,22 @@
 #pragma once
 
 #include <string>
+#include <utility>
 #include <variant>
-#include <optional>
+#include <vector>
 
 namespace TemplateBuilder {
 
 enum class VariableType {
-    vtString
+    vtString,
+    vtList,
+    vtMap
 };
 
+// Ordered key/value pairs; a flat vector keeps map variables compact and in YAML order
+using VariableList = std::vector<std::string>;
+using VariableMap = std::vector<std::pair<std::string, std::string>>;
+
 class Variable {
 public:
     // Constructors
@@ -21,13 +28,22 @@ public:
     [[nodiscard]] const std::string& getName() const noexcept { return m_name; }
     [[nodiscard]] VariableType getType() const noexcept { return m_type; }
     [[nodiscard]] const std::string& getValue() const;
-    [[nodiscard]] bool hasValue() const noexcept { return m_value.has_value(); }
+    [[nodiscard]] const VariableList& getList() const;
+    [[nodiscard]] const VariableMap& getMap() const;
+    [[nodiscard]] bool hasValue() const noexcept { return !std::holds_alternative<std::monostate>(m_value); }
+    [[nodiscard]] bool isList() const noexcept { return std::holds_alternative<VariableList>(m_value); }
+    [[nodiscard]] bool isMap() const noexcept { return std::holds_alternative<VariableMap>(m_value); }
+
+    // Value as template text: lists are one item per line, maps "key: value" per line
+    [[nodiscard]] std::string getText() const;
 
     // Setters
     void setName(const std::string& name) { m_name = name; }
     void setType(VariableType type) { m_type = type; }
     void setValue(const std::string& value) { m_value = value; }
-    void clearValue() { m_value.reset(); }
+    void setList(VariableList list) { m_value = std::move(list); }
+    void setMap(VariableMap map) { m_value = std::move(map); }
+    void clearValue() { m_value = std::monostate(); }
 
     // Conversion helper
     [[nodiscard]] static VariableType stringToType(const std::string& typeStr);
@@ -35,7 +51,7 @@ public:
 private:
     std::string m_name;
     VariableType m_type = VariableType::vtString;
-    std::optional<std::string> m_value;
+    std::variant<std::monostate, std::string, VariableList, VariableMap> m_value;
 };
 
 } // namespace TemplateBuilder
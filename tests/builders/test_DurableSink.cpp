@@ -0,0 +1,102 @@
+#include <gtest/gtest.h>
+#include "../../src/builders/DurableSink.hpp"
+#include <filesystem>
+#include <fstream>
+#include <sstream>
+
+using namespace TemplateBuilder;
+
+class DurableSinkTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        workPath = std::filesystem::temp_directory_path() / "test_DurableSink";
+        std::filesystem::remove_all(workPath);
+        std::filesystem::create_directories(workPath);
+        target = workPath / "output";
+    }
+
+    void TearDown() override {
+        std::filesystem::remove_all(workPath);
+    }
+
+    static std::string readFile(const std::filesystem::path& path) {
+        std::ifstream stream(path);
+        std::stringstream content;
+        content << stream.rdbuf();
+        return content.str();
+    }
+
+    std::filesystem::path workPath;
+    std::filesystem::path target;
+};
+
+TEST_F(DurableSinkTest, Commit_PublishesNewTree) {
+    DurableSink sink(target);
+    sink.writeFile("a/b.txt", "content");
+    sink.createFolder("empty/");
+    EXPECT_FALSE(std::filesystem::exists(target));
+
+    const DurableStats stats = sink.commit();
+
+    EXPECT_EQ(stats.files, 1u);
+    EXPECT_FALSE(stats.exchanged);
+    EXPECT_EQ(readFile(target / "a/b.txt"), "content");
+    EXPECT_TRUE(std::filesystem::is_directory(target / "empty"));
+    EXPECT_FALSE(std::filesystem::exists(sink.getStaging()));
+}
+
+TEST_F(DurableSinkTest, Commit_ReplacesExistingTree) {
+    std::filesystem::create_directories(target);
+    std::ofstream(target / "stale.txt") << "old";
+
+    DurableSink sink(target);
+    sink.writeFile("fresh.txt", "new");
+    sink.commit();
+
+    EXPECT_FALSE(std::filesystem::exists(target / "stale.txt"));
+    EXPECT_EQ(readFile(target / "fresh.txt"), "new");
+    EXPECT_EQ(std::distance(std::filesystem::directory_iterator(workPath), std::filesystem::directory_iterator()), 1);
+}
+
+TEST_F(DurableSinkTest, Destructor_WithoutCommit_LeavesTargetUntouched) {
+    std::filesystem::create_directories(target);
+    std::ofstream(target / "keep.txt") << "keep";
+
+    std::filesystem::path staging;
+    {
+        DurableSink sink(target);
+        staging = sink.getStaging();
+        sink.writeFile("partial.txt", "partial");
+    }
+
+    EXPECT_FALSE(std::filesystem::exists(staging));
+    EXPECT_FALSE(std::filesystem::exists(target / "partial.txt"));
+    EXPECT_EQ(readFile(target / "keep.txt"), "keep");
+}
+
+TEST_F(DurableSinkTest, Commit_Twice_Throws) {
+    DurableSink sink(target);
+    sink.commit();
+    EXPECT_THROW(sink.commit(), std::runtime_error);
+}
+
+TEST_F(DurableSinkTest, Constructor_AfterInterruptedPublish_RestoresPreviousTree) {
+    const auto previous = workPath / ".output.previous";
+    std::filesystem::create_directories(previous);
+    std::ofstream(previous / "old.txt") << "old";
+
+    DurableSink sink(target);
+    EXPECT_FALSE(std::filesystem::exists(previous));
+    EXPECT_EQ(readFile(target / "old.txt"), "old");
+}
+
+TEST_F(DurableSinkTest, Constructor_AfterFinishedPublish_RemovesPreviousTree) {
+    const auto previous = workPath / ".output.previous";
+    std::filesystem::create_directories(previous);
+    std::filesystem::create_directories(target);
+    std::ofstream(target / "new.txt") << "new";
+
+    DurableSink sink(target);
+    EXPECT_FALSE(std::filesystem::exists(previous));
+    EXPECT_EQ(readFile(target / "new.txt"), "new");
+}
@@ -0,0 +1,100 @@
+#include <gtest/gtest.h>
+#include "../../src/builders/EachExpander.hpp"
+#include "../../src/builders/FileBuilder.hpp"
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+using namespace TemplateBuilder;
+
+class EachExpanderTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        project = std::make_unique<Variable>("project", VariableType::vtString, "demo");
+        modules = std::make_unique<Variable>("modules", VariableType::vtList);
+        modules->setList({"core", "net", "ui"});
+        ports = std::make_unique<Variable>("ports", VariableType::vtMap);
+        ports->setMap({{"http", "80"}, {"https", "443"}});
+        lines = std::make_unique<Variable>("lines", VariableType::vtString, "a\n\nb\n");
+
+        variables = {project.get(), modules.get(), ports.get(), lines.get()};
+    }
+
+    std::vector<std::pair<std::string, std::string>> expand(const FileData& entry) {
+        std::vector<std::pair<std::string, std::string>> outputs;
+        expander.expand(entry, &variables, [&](const std::string& path, const std::vector<Variable*>* scope) {
+            outputs.emplace_back(path, fileBuilder.render(entry, scope));
+        });
+        return outputs;
+    }
+
+    std::unique_ptr<Variable> project;
+    std::unique_ptr<Variable> modules;
+    std::unique_ptr<Variable> ports;
+    std::unique_ptr<Variable> lines;
+    std::vector<Variable*> variables;
+    EachExpander expander;
+    FileBuilder fileBuilder;
+};
+
+TEST_F(EachExpanderTest, WithoutEach_VisitsOnceWithRawPath) {
+    FileData entry("src/{{project}}.txt", "{{project}}");
+    const auto outputs = expand(entry);
+    ASSERT_EQ(outputs.size(), 1u);
+    EXPECT_EQ(outputs[0].first, "src/{{project}}.txt");
+    EXPECT_EQ(outputs[0].second, "demo");
+}
+
+TEST_F(EachExpanderTest, List_BindsItemInPathAndContent) {
+    FileData entry("src/{{module}}/{{module}}.cpp", "// {{project}}: {{upper(module)}}");
+    entry.setEach("modules");
+    entry.setEachAs("module");
+
+    const auto outputs = expand(entry);
+    ASSERT_EQ(outputs.size(), 3u);
+    EXPECT_EQ(outputs[0].first, "src/core/core.cpp");
+    EXPECT_EQ(outputs[2].first, "src/ui/ui.cpp");
+    EXPECT_EQ(outputs[1].second, "// demo: NET");
+}
+
+TEST_F(EachExpanderTest, Map_BindsKeyAndValue) {
+    FileData entry("conf/{{item.key}}.conf", "port={{item.value}}");
+    entry.setEach("PORTS");
+
+    const auto outputs = expand(entry);
+    ASSERT_EQ(outputs.size(), 2u);
+    EXPECT_EQ(outputs[0].first, "conf/http.conf");
+    EXPECT_EQ(outputs[1].second, "port=443");
+}
+
+TEST_F(EachExpanderTest, String_FansOutPerNonEmptyLine) {
+    FileData entry("{{item}}.txt", "");
+    entry.setEach("lines");
+
+    const auto outputs = expand(entry);
+    ASSERT_EQ(outputs.size(), 2u);
+    EXPECT_EQ(outputs[1].first, "b.txt");
+}
+
+TEST_F(EachExpanderTest, BindingShadowsTemplateVariable) {
+    FileData entry("{{project}}.txt", "{{project}}");
+    entry.setEach("modules");
+    entry.setEachAs("project");
+
+    const auto outputs = expand(entry);
+    ASSERT_EQ(outputs.size(), 3u);
+    EXPECT_EQ(outputs[0].first, "core.txt");
+    EXPECT_EQ(outputs[0].second, "core");
+}
+
+TEST_F(EachExpanderTest, UnsetOrUnknownSource) {
+    modules->clearValue();
+    FileData entry("{{item}}", "");
+    entry.setEach("modules");
+    EXPECT_TRUE(expand(entry).empty());
+
+    entry.setEach("missing");
+    EXPECT_THROW(expand(entry), std::runtime_error);
+}
@@ -0,0 +1,70 @@
+#include <gtest/gtest.h>
+#include "../../src/builders/FileBuilder.hpp"
+#include "../../src/types/FileType.hpp"
+#include "../../src/types/VariableType.hpp"
+#include <filesystem>
+#include <fstream>
+#include <memory>
+#include <sstream>
+#include <vector>
+
+using namespace TemplateBuilder;
+
+class FileBuilderTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        originalPath = std::filesystem::current_path();
+        workPath = std::filesystem::temp_directory_path() / "test_FileBuilder";
+        std::filesystem::remove_all(workPath);
+        std::filesystem::create_directories(workPath);
+        std::filesystem::current_path(workPath);
+
+        name = std::make_unique<Variable>("name", VariableType::vtString, "World");
+        variables.push_back(name.get());
+    }
+
+    void TearDown() override {
+        std::filesystem::current_path(originalPath);
+        std::filesystem::remove_all(workPath);
+    }
+
+    static std::string readFile(const std::filesystem::path& path) {
+        std::ifstream stream(path);
+        std::stringstream content;
+        content << stream.rdbuf();
+        return content.str();
+    }
+
+    std::filesystem::path originalPath;
+    std::filesystem::path workPath;
+    std::unique_ptr<Variable> name;
+    std::vector<Variable*> variables;
+};
+
+TEST_F(FileBuilderTest, Build_CreatesParentDirectoriesAndContent) {
+    FileData file("nested/dir/hello.txt", "Hello {{name}}");
+    file.setVariables(&variables);
+
+    FileBuilder builder;
+    builder.build(file);
+
+    EXPECT_EQ(readFile(workPath / "nested/dir/hello.txt"), "Hello World");
+}
+
+TEST_F(FileBuilderTest, Render_UsesPromptResult) {
+    Prompt prompt("prompt");
+    prompt.setResult("# {{name}}");
+
+    FileData file("README.md", "ignored");
+    file.setVariables(&variables);
+    file.setPrompt(&prompt);
+
+    FileBuilder builder;
+    EXPECT_EQ(builder.render(file), "# World");
+}
+
+TEST_F(FileBuilderTest, Build_EmptyPath_Throws) {
+    FileData file("", "content");
+    FileBuilder builder;
+    EXPECT_THROW(builder.build(file), std::runtime_error);
+}
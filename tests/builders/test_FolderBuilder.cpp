@@ -0,0 +1,43 @@
+#include <gtest/gtest.h>
+#include "../../src/builders/FolderBuilder.hpp"
+#include "../../src/types/FileType.hpp"
+#include <filesystem>
+
+using namespace TemplateBuilder;
+
+class FolderBuilderTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        originalPath = std::filesystem::current_path();
+        workPath = std::filesystem::temp_directory_path() / "test_FolderBuilder";
+        std::filesystem::remove_all(workPath);
+        std::filesystem::create_directories(workPath);
+        std::filesystem::current_path(workPath);
+    }
+
+    void TearDown() override {
+        std::filesystem::current_path(originalPath);
+        std::filesystem::remove_all(workPath);
+    }
+
+    std::filesystem::path originalPath;
+    std::filesystem::path workPath;
+};
+
+TEST_F(FolderBuilderTest, Build_TrailingSeparator_CreatesFullPath) {
+    FolderBuilder builder;
+    builder.build(FileData("a/b/c/", ""));
+    EXPECT_TRUE(std::filesystem::is_directory(workPath / "a/b/c"));
+}
+
+TEST_F(FolderBuilderTest, Build_WithoutTrailingSeparator_CreatesParent) {
+    FolderBuilder builder;
+    builder.build(FileData("x/y/z", ""));
+    EXPECT_TRUE(std::filesystem::is_directory(workPath / "x/y"));
+    EXPECT_FALSE(std::filesystem::exists(workPath / "x/y/z"));
+}
+
+TEST_F(FolderBuilderTest, Build_EmptyPath_Throws) {
+    FolderBuilder builder;
+    EXPECT_THROW(builder.build(FileData("", "")), std::runtime_error);
+}
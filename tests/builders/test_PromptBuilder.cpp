@@ -0,0 +1,110 @@
+#include <gtest/gtest.h>
+#include "../../src/builders/PromptBuilder.hpp"
+#include "../../src/types/PromptType.hpp"
+#include "../../src/types/VariableType.hpp"
+#include <memory>
+#include <sstream>
+#include <stdexcept>
+#include <vector>
+
+using namespace TemplateBuilder;
+
+class PromptBuilderTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        projectName = std::make_unique<Variable>("projectName", VariableType::vtString, "My Project");
+        technologies = std::make_unique<Variable>("technologies", VariableType::vtString, "C++\nCMake\n");
+        empty = std::make_unique<Variable>("empty", VariableType::vtString);
+
+        variables.push_back(projectName.get());
+        variables.push_back(technologies.get());
+        variables.push_back(empty.get());
+    }
+
+    std::unique_ptr<Variable> projectName;
+    std::unique_ptr<Variable> technologies;
+    std::unique_ptr<Variable> empty;
+    std::vector<Variable*> variables;
+    std::istringstream input;
+    std::ostringstream output;
+};
+
+TEST_F(PromptBuilderTest, GetContent_NullVariables_ReturnsContentUnchanged) {
+    PromptBuilder builder(input, output);
+    EXPECT_EQ(builder.getContent("Hello {{projectName}}", nullptr), "Hello {{projectName}}");
+}
+
+TEST_F(PromptBuilderTest, GetContent_ReplacesPlaceholders) {
+    PromptBuilder builder(input, output);
+    EXPECT_EQ(builder.getContent("# {{projectName}}{{empty}}", &variables), "# My Project");
+}
+
+TEST_F(PromptBuilderTest, GetContent_PrefixPattern_PrefixesEachLine) {
+    PromptBuilder builder(input, output);
+    EXPECT_EQ(builder.getContent("{{\"- \" | technologies}}", &variables), "- C++\n- CMake");
+}
+
+TEST_F(PromptBuilderTest, GetContent_Functions) {
+    PromptBuilder builder(input, output);
+    EXPECT_EQ(builder.getContent("{{upper(projectName)}}", &variables), "MY PROJECT");
+    EXPECT_EQ(builder.getContent("{{lower(projectName)}}", &variables), "my project");
+    EXPECT_EQ(builder.getContent("{{replace(\" \", \"_\", projectName)}}", &variables), "My_Project");
+}
+
+TEST_F(PromptBuilderTest, GetContent_NestedFunctions) {
+    PromptBuilder builder(input, output);
+    EXPECT_EQ(builder.getContent("function {{lower(replace(\" \", \"_\", projectName))}}_init()", &variables),
+              "function my_project_init()");
+}
+
+TEST_F(PromptBuilderTest, GetContent_UnknownFunction_Throws) {
+    PromptBuilder builder(input, output);
+    EXPECT_THROW((void)builder.getContent("{{reverse(projectName)}}", &variables), std::invalid_argument);
+    EXPECT_THROW((void)builder.getContent("{{upper(projectName, empty)}}", &variables), std::invalid_argument);
+}
+
+TEST_F(PromptBuilderTest, Build_InputString_SetsVariable) {
+    input.str("Other Name\n");
+    PromptBuilder builder(input, output);
+
+    Prompt prompt("prompt");
+    auto promptInput = std::make_unique<PromptInput>(PromptType::ptInputString);
+    promptInput->setVariable(projectName.get());
+    promptInput->setInput("Project name: ");
+    prompt.addInput(std::move(promptInput));
+    prompt.setResult("# {{projectName}}");
+
+    EXPECT_EQ(builder.build(&prompt, &variables), "# Other Name");
+    EXPECT_EQ(output.str(), "Project name: ");
+}
+
+TEST_F(PromptBuilderTest, Build_Checklist_JoinsSelectedValues) {
+    input.str("1, 3\n");
+    PromptBuilder builder(input, output);
+
+    PromptInput promptInput(PromptType::ptChecklist);
+    promptInput.setVariable(empty.get());
+    promptInput.addOption("A", "alpha");
+    promptInput.addOption("B", "beta");
+    promptInput.addOption("C", "gamma");
+
+    builder.collectInput(promptInput);
+    EXPECT_EQ(empty->getValue(), "alpha\ngamma");
+}
+
+TEST_F(PromptBuilderTest, Build_ArrayList_StopsOnEmptyLine) {
+    input.str("one\ntwo\n\nignored\n");
+    PromptBuilder builder(input, output);
+
+    PromptInput promptInput(PromptType::ptArrayList);
+    promptInput.setVariable(empty.get());
+
+    builder.collectInput(promptInput);
+    EXPECT_EQ(empty->getValue(), "one\ntwo\n");
+}
+
+TEST_F(PromptBuilderTest, CollectInput_WithoutVariable_Throws) {
+    PromptBuilder builder(input, output);
+    PromptInput promptInput(PromptType::ptInputString);
+    EXPECT_THROW(builder.collectInput(promptInput), std::runtime_error);
+}
@@ -0,0 +1,130 @@
+#include <gtest/gtest.h>
+#include "../../src/builders/UringSink.hpp"
+#include <filesystem>
+#include <fstream>
+#include <sstream>
+#include <system_error>
+
+using namespace TemplateBuilder;
+
+class UringSinkTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        rootPath = std::filesystem::temp_directory_path() / "test_UringSink";
+        std::filesystem::remove_all(rootPath);
+    }
+
+    void TearDown() override {
+        std::filesystem::remove_all(rootPath);
+    }
+
+    static std::string readFile(const std::filesystem::path& path) {
+        std::ifstream stream(path, std::ios::binary);
+        std::stringstream content;
+        content << stream.rdbuf();
+        return content.str();
+    }
+
+    std::filesystem::path rootPath;
+};
+
+TEST_F(UringSinkTest, WriteFile_AcrossBatches_CreatesNestedFiles) {
+    {
+        UringSink sink(rootPath, 16);
+        EXPECT_EQ(sink.isUringActive(), UringSink::isSupported());
+        for (int i = 0; i < 300; ++i) {
+            sink.writeFile("module" + std::to_string(i % 7) + "/deep/nested/file" + std::to_string(i) + ".txt",
+                           "content " + std::to_string(i));
+        }
+        sink.flush();
+        EXPECT_EQ(sink.getFilesWritten(), 300u);
+    }
+
+    EXPECT_EQ(readFile(rootPath / "module0/deep/nested/file0.txt"), "content 0");
+    EXPECT_EQ(readFile(rootPath / "module5/deep/nested/file299.txt"), "content 299");
+}
+
+TEST_F(UringSinkTest, WriteFile_EmptyAndOverwritten_KeepsLatestContent) {
+    std::filesystem::create_directories(rootPath);
+    std::ofstream(rootPath / "existing.txt") << "a much longer previous content";
+
+    UringSink sink(rootPath);
+    sink.writeFile("empty.txt", "");
+    sink.writeFile("twice.txt", "first");
+    sink.writeFile("twice.txt", "second");
+    sink.writeFile("existing.txt", "short");
+    sink.flush();
+
+    EXPECT_TRUE(std::filesystem::exists(rootPath / "empty.txt"));
+    EXPECT_EQ(readFile(rootPath / "empty.txt"), "");
+    EXPECT_EQ(readFile(rootPath / "twice.txt"), "second");
+    EXPECT_EQ(readFile(rootPath / "existing.txt"), "short");
+}
+
+TEST_F(UringSinkTest, CreateFolder_CreatesDirectories) {
+    UringSink sink(rootPath);
+    sink.createFolder("src/components/");
+    sink.createFolder("docs/readme.md");
+    sink.flush();
+
+    EXPECT_TRUE(std::filesystem::is_directory(rootPath / "src/components"));
+    EXPECT_TRUE(std::filesystem::is_directory(rootPath / "docs"));
+    EXPECT_FALSE(std::filesystem::exists(rootPath / "docs/readme.md"));
+}
+
+TEST_F(UringSinkTest, Flush_FailedFile_ReportsItAndWritesTheRest) {
+    std::filesystem::create_directories(rootPath);
+    std::ofstream(rootPath / "blocker") << "not a directory";
+
+    UringSink sink(rootPath);
+    sink.writeFile("ok.txt", "fine");
+    if (sink.isUringActive()) {
+        sink.writeFile("blocker/child.txt", "fails");
+        sink.writeFile("after.txt", "still written");
+        EXPECT_THROW(sink.flush(), std::system_error);
+        EXPECT_EQ(readFile(rootPath / "after.txt"), "still written");
+    } else {
+        EXPECT_ANY_THROW(sink.writeFile("blocker/child.txt", "fails"));
+    }
+    EXPECT_EQ(readFile(rootPath / "ok.txt"), "fine");
+}
+
+TEST_F(UringSinkTest, WriteFile_EmptyPath_Throws) {
+    UringSink sink(rootPath);
+    EXPECT_THROW(sink.writeFile("", "content"), std::runtime_error);
+}
+
+TEST_F(UringSinkTest, WriteFile_FullBatchFailure_IsReportedByFlush) {
+    std::filesystem::create_directories(rootPath);
+    std::ofstream(rootPath / "blocker") << "not a directory";
+
+    UringSink sink(rootPath, 2);
+    if (!sink.isUringActive()) {
+        GTEST_SKIP() << "io_uring unavailable";
+    }
+    sink.writeFile("blocker/child.txt", "fails");
+    EXPECT_NO_THROW(sink.writeFile("ok.txt", "fine"));  // Fills the batch and writes it
+
+    const auto failures = sink.getFailures();
+    ASSERT_EQ(failures.size(), 1u);
+    EXPECT_EQ(failures[0].path, "blocker/child.txt");
+    EXPECT_THROW(sink.flush(), std::system_error);
+    EXPECT_NO_THROW(sink.flush());  // Each failure is reported once
+    EXPECT_EQ(readFile(rootPath / "ok.txt"), "fine");
+}
+
+TEST_F(UringSinkTest, SharedDirectoryCache_RecordsCreatedDirectories) {
+    auto directories = std::make_shared<DirectoryCache>();
+    {
+        UringSink sink(rootPath, directories);
+        sink.writeFile("a/b/c.txt", "content");
+        sink.flush();
+    }
+    EXPECT_TRUE(directories->contains(rootPath / "a/b"));
+    EXPECT_TRUE(directories->contains(rootPath / "a/b/"));
+
+    UringSink second(rootPath, directories);
+    second.writeFile("a/b/d.txt", "more");
+    second.flush();
+    EXPECT_EQ(readFile(rootPath / "a/b/d.txt"), "more");
+}
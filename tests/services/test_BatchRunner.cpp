@@ -0,0 +1,181 @@
+#include <gtest/gtest.h>
+#include "../../src/services/BatchRunner.hpp"
+#include <filesystem>
+#include <fstream>
+#include <sstream>
+
+using namespace TemplateBuilder;
+
+class BatchRunnerTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        workPath = std::filesystem::temp_directory_path() / "test_BatchRunner";
+        std::filesystem::remove_all(workPath);
+        std::filesystem::create_directories(workPath / "templates");
+        std::filesystem::create_directories(workPath / "out");
+
+        writeFile("templates/shared.txt", "shared {{name}}");
+        for (int i = 0; i < 6; ++i) {
+            const std::string id = std::to_string(i);
+            writeFile("templates/t" + id + ".yaml",
+                "version: 1.0\n"
+                "variables:\n"
+                "  - name: name\n"
+                "    type: string\n"
+                "    value: t" + id + "\n"
+                "files:\n"
+                "  - path: t" + id + "/a.txt\n"
+                "    source: shared.txt\n"
+                "  - path: t" + id + "/b.txt\n"
+                "    content: \"{{upper(name)}}\"\n");
+        }
+        writeFile("templates/notes.md", "ignored by directory expansion");
+    }
+
+    void TearDown() override {
+        std::filesystem::remove_all(workPath);
+    }
+
+    std::filesystem::path writeFile(const std::string& name, const std::string& content) {
+        const std::filesystem::path path = workPath / name;
+        std::ofstream stream(path);
+        stream << content;
+        return path;
+    }
+
+    static std::string readFile(const std::filesystem::path& path) {
+        std::ifstream stream(path);
+        std::stringstream content;
+        content << stream.rdbuf();
+        return content.str();
+    }
+
+    std::filesystem::path workPath;
+};
+
+TEST_F(BatchRunnerTest, CollectTemplates_ExpandsDirectoriesAndManifests) {
+    const auto manifest = writeFile("list.txt", "# nightly\ntemplates/t1.yaml\n\n  templates/t2.yaml  \n");
+
+    const auto fromDirectory = BatchRunner::collectTemplates({(workPath / "templates").string()});
+    ASSERT_EQ(fromDirectory.size(), 6u);
+    EXPECT_EQ(std::filesystem::path(fromDirectory[0]).filename(), "t0.yaml");
+
+    const auto fromManifest = BatchRunner::collectTemplates({"@" + manifest.string(), "plain.yaml"});
+    ASSERT_EQ(fromManifest.size(), 3u);
+    EXPECT_EQ(std::filesystem::path(fromManifest[1]), workPath / "templates/t2.yaml");
+    EXPECT_EQ(fromManifest[2], "plain.yaml");
+}
+
+TEST_F(BatchRunnerTest, Run_RendersAllTemplatesWithSharedCache) {
+    BatchRunner runner(4);
+    const auto templates = BatchRunner::collectTemplates({(workPath / "templates").string()});
+    const auto results = runner.run(templates, workPath / "out");
+
+    ASSERT_EQ(results.size(), 6u);
+    for (const auto& result : results) {
+        EXPECT_TRUE(result.success) << result.error;
+        EXPECT_EQ(result.files, 2u);
+    }
+    EXPECT_EQ(readFile(workPath / "out/t3/a.txt"), "shared t3");
+    EXPECT_EQ(readFile(workPath / "out/t5/b.txt"), "T5");
+    EXPECT_EQ(runner.getCache().getTemplateCount(), 6u);
+    EXPECT_EQ(runner.getCache().getSourceCount(), 1u);
+}
+
+TEST_F(BatchRunnerTest, Run_FailureDoesNotAbortOthers) {
+    writeFile("templates/broken.yaml", "version: 7.0\n");
+
+    BatchRunner runner(2);
+    const auto results = runner.run({(workPath / "templates/t0.yaml").string(),
+                                     (workPath / "templates/broken.yaml").string(),
+                                     (workPath / "missing.yaml").string(),
+                                     (workPath / "templates/t1.yaml").string()},
+                                    workPath / "out");
+
+    ASSERT_EQ(results.size(), 4u);
+    EXPECT_TRUE(results[0].success);
+    EXPECT_FALSE(results[1].success);
+    EXPECT_NE(results[1].error.find("not supported"), std::string::npos);
+    EXPECT_FALSE(results[2].success);
+    EXPECT_TRUE(results[3].success);
+    EXPECT_TRUE(std::filesystem::exists(workPath / "out/t1/b.txt"));
+}
+
+TEST_F(BatchRunnerTest, CollectTemplates_MissingManifest_Throws) {
+    EXPECT_THROW((void)BatchRunner::collectTemplates({"@" + (workPath / "none.txt").string()}), std::runtime_error);
+}
+
+TEST_F(BatchRunnerTest, Run_WithIoUring_WritesSameOutput) {
+    BatchRunner runner(2);
+    runner.setIoUring(true);
+    const auto results = runner.run({(workPath / "templates/t0.yaml").string(),
+                                     (workPath / "templates/t4.yaml").string()},
+                                    workPath / "out");
+
+    ASSERT_EQ(results.size(), 2u);
+    EXPECT_TRUE(results[0].success) << results[0].error;
+    EXPECT_EQ(results[1].files, 2u);
+    EXPECT_EQ(readFile(workPath / "out/t0/a.txt"), "shared t0");
+    EXPECT_EQ(readFile(workPath / "out/t4/b.txt"), "T4");
+}
+
+TEST_F(BatchRunnerTest, Run_CollidingOutputs_FailsEveryTemplateInvolved) {
+    writeFile("templates/clash.yaml",
+        "version: 1.0\n"
+        "files:\n"
+        "  - path: t1/a.txt\n"
+        "    content: clash\n");
+
+    BatchRunner runner(2);
+    const auto results = runner.run({(workPath / "templates/t0.yaml").string(),
+                                     (workPath / "templates/t1.yaml").string(),
+                                     (workPath / "templates/clash.yaml").string()},
+                                    workPath / "out");
+
+    ASSERT_EQ(results.size(), 3u);
+    EXPECT_TRUE(results[0].success) << results[0].error;
+    EXPECT_FALSE(results[1].success);
+    EXPECT_FALSE(results[2].success);
+    EXPECT_NE(results[2].error.find("t1/a.txt"), std::string::npos) << results[2].error;
+    EXPECT_TRUE(std::filesystem::exists(workPath / "out/t0/a.txt"));
+    EXPECT_FALSE(std::filesystem::exists(workPath / "out/t1"));
+}
+
+TEST_F(BatchRunnerTest, Run_SameTemplateListedTwice_RendersOnce) {
+    BatchRunner runner(2);
+    const auto results = runner.run({(workPath / "templates/t0.yaml").string(),
+                                     (workPath / "templates/../templates/t0.yaml").string()},
+                                    workPath / "out");
+
+    ASSERT_EQ(results.size(), 2u);
+    EXPECT_TRUE(results[0].success) << results[0].error;
+    EXPECT_TRUE(results[1].success) << results[1].error;
+    EXPECT_EQ(results[1].files, results[0].files);
+    EXPECT_EQ(results[1].templatePath, (workPath / "templates/../templates/t0.yaml").string());
+    EXPECT_EQ(runner.getCache().getTemplateCount(), 1u);
+    EXPECT_EQ(readFile(workPath / "out/t0/a.txt"), "shared t0");
+}
+
+TEST_F(BatchRunnerTest, Run_WithIoUring_AttributesWriteFailures) {
+    writeFile("out/blocker", "not a directory");
+    writeFile("templates/blocked.yaml",
+        "version: 1.0\n"
+        "files:\n"
+        "  - path: blocker/x.txt\n"
+        "    content: never\n");
+
+    BatchRunner runner(1);
+    runner.setIoUring(true);
+    const auto results = runner.run({(workPath / "templates/t0.yaml").string(),
+                                     (workPath / "templates/blocked.yaml").string(),
+                                     (workPath / "templates/t1.yaml").string()},
+                                    workPath / "out");
+
+    ASSERT_EQ(results.size(), 3u);
+    EXPECT_TRUE(results[0].success) << results[0].error;
+    EXPECT_FALSE(results[1].success);
+    EXPECT_NE(results[1].error.find("blocker"), std::string::npos) << results[1].error;
+    EXPECT_TRUE(results[2].success) << results[2].error;
+    EXPECT_EQ(results[2].files, 2u);
+    EXPECT_EQ(readFile(workPath / "out/t1/b.txt"), "T1");
+}
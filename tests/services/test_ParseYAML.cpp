@@ -0,0 +1,197 @@
+#include <gtest/gtest.h>
+#include "../../src/services/ParseYAML.hpp"
+#include <filesystem>
+#include <fstream>
+#include <sstream>
+
+using namespace TemplateBuilder;
+
+class ParseYAMLTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        workPath = std::filesystem::temp_directory_path() / "test_ParseYAML";
+        std::filesystem::remove_all(workPath);
+        std::filesystem::create_directories(workPath);
+    }
+
+    void TearDown() override {
+        std::filesystem::remove_all(workPath);
+    }
+
+    std::string writeFile(const std::string& name, const std::string& content) {
+        const std::filesystem::path path = workPath / name;
+        std::ofstream stream(path);
+        stream << content;
+        return path.string();
+    }
+
+    std::filesystem::path workPath;
+    std::istringstream input;
+    std::ostringstream output;
+};
+
+TEST_F(ParseYAMLTest, LoadsAllSections) {
+    writeFile("body.txt", "Body of {{name}}");
+    const std::string fileName = writeFile("template.yaml",
+        "version: 1.0\n"
+        "variables:\n"
+        "  - name: name\n"
+        "    type: string\n"
+        "    value: Demo\n"
+        "prompts:\n"
+        "  - name: askName\n"
+        "    inputs:\n"
+        "      - variable: name\n"
+        "        input: \"Name: \"\n"
+        "        type: InputString\n"
+        "    result: \"# {{name}}\"\n"
+        "files:\n"
+        "  - path: out/README.md\n"
+        "    prompt: askName\n"
+        "  - path: out/body.txt\n"
+        "    source: body.txt\n"
+        "folders:\n"
+        "  - path: out/empty/\n");
+
+    ParserYAML parser(fileName, PromptBuilder(input, output));
+
+    EXPECT_EQ(parser.getVersion(), "1.0");
+    ASSERT_EQ(parser.getVariables().size(), 1u);
+    EXPECT_EQ(parser.getVariables()[0]->getValue(), "Demo");
+    ASSERT_EQ(parser.getPrompts().size(), 1u);
+    EXPECT_EQ(parser.getPrompts()[0]->getInputsCount(), 1u);
+    ASSERT_EQ(parser.getFiles().size(), 2u);
+    EXPECT_EQ(parser.getFiles()[0]->getPrompt(), parser.findPrompt("ASKNAME"));
+    EXPECT_EQ(parser.getFiles()[1]->getContent(), "Body of {{name}}");
+    ASSERT_EQ(parser.getSources().size(), 1u);
+    EXPECT_EQ(parser.getSources()[0], (workPath / "body.txt").lexically_normal());
+    ASSERT_EQ(parser.getFolders().size(), 1u);
+    EXPECT_EQ(parser.getFolders()[0]->getPath(), "out/empty/");
+}
+
+TEST_F(ParseYAMLTest, ReloadSource_UpdatesReferencingFiles) {
+    writeFile("body.txt", "old");
+    const std::string fileName = writeFile("template.yaml",
+        "version: 1.0\n"
+        "files:\n"
+        "  - path: a.txt\n"
+        "    source: body.txt\n"
+        "  - path: b.txt\n"
+        "    content: static\n");
+
+    ParserYAML parser(fileName, PromptBuilder(input, output));
+    writeFile("body.txt", "new");
+
+    EXPECT_EQ(parser.reloadSource(workPath / "body.txt"), 1u);
+    EXPECT_EQ(parser.getFiles()[0]->getContent(), "new");
+    EXPECT_EQ(parser.getFiles()[1]->getContent(), "static");
+}
+
+TEST_F(ParseYAMLTest, MissingVersion_Throws) {
+    const std::string fileName = writeFile("template.yaml", "files: []\n");
+    EXPECT_THROW(ParserYAML parser(fileName), std::runtime_error);
+}
+
+TEST_F(ParseYAMLTest, UnsupportedVersion_Throws) {
+    const std::string fileName = writeFile("template.yaml", "version: 2.0\n");
+    EXPECT_THROW(ParserYAML parser(fileName), UnsupportedTemplateVersion);
+}
+
+TEST_F(ParseYAMLTest, UnknownVariableType_Throws) {
+    const std::string fileName = writeFile("template.yaml",
+        "version: 1.0\n"
+        "variables:\n"
+        "  - name: count\n"
+        "    type: integer\n");
+    EXPECT_THROW(ParserYAML parser(fileName), std::runtime_error);
+}
+
+TEST_F(ParseYAMLTest, MissingFile_Throws) {
+    EXPECT_THROW(ParserYAML parser((workPath / "missing.yaml").string()), std::runtime_error);
+}
+
+TEST_F(ParseYAMLTest, ListAndMapVariablesWithEach) {
+    const std::string fileName = writeFile("template.yaml",
+        "version: 1.0\n"
+        "variables:\n"
+        "  - name: modules\n"
+        "    type: list\n"
+        "    value: [core, net]\n"
+        "  - name: ports\n"
+        "    type: map\n"
+        "    value:\n"
+        "      http: 80\n"
+        "      https: 443\n"
+        "files:\n"
+        "  - path: \"src/{{module}}.cpp\"\n"
+        "    each: modules\n"
+        "    as: module\n"
+        "    content: \"// {{module}}\"\n"
+        "folders:\n"
+        "  - path: \"conf/{{item.key}}/\"\n"
+        "    each: ports\n");
+
+    ParserYAML parser(fileName, PromptBuilder(input, output));
+
+    EXPECT_EQ(parser.findVariable("modules")->getList(), (VariableList{"core", "net"}));
+    EXPECT_EQ(parser.findVariable("ports")->getMap()[1], (std::pair<std::string, std::string>{"https", "443"}));
+    ASSERT_EQ(parser.getFiles().size(), 1u);
+    EXPECT_EQ(parser.getFiles()[0]->getEach(), "modules");
+    EXPECT_EQ(parser.getFiles()[0]->getEachAs(), "module");
+    EXPECT_EQ(parser.getFolders()[0]->getEachAs(), "item");
+
+    MemorySink sink;
+    parser.buildAll(sink);
+    EXPECT_EQ(sink.getFiles().at("src/net.cpp"), "// net");
+    EXPECT_EQ(sink.getFolders().count("conf/https/"), 1u);
+}
+
+TEST_F(ParseYAMLTest, EachWithUnknownVariable_Throws) {
+    const std::string fileName = writeFile("template.yaml",
+        "version: 1.0\n"
+        "files:\n"
+        "  - path: \"{{item}}\"\n"
+        "    each: missing\n");
+    EXPECT_THROW(ParserYAML parser(fileName), std::runtime_error);
+}
+
+TEST_F(ParseYAMLTest, ListVariableWithScalarValue_Throws) {
+    const std::string fileName = writeFile("template.yaml",
+        "version: 1.0\n"
+        "variables:\n"
+        "  - name: modules\n"
+        "    type: list\n"
+        "    value: core\n");
+    EXPECT_THROW(ParserYAML parser(fileName), std::runtime_error);
+}
+
+TEST_F(ParseYAMLTest, EachWithEmptyAs_Throws) {
+    const std::string fileName = writeFile("template.yaml",
+        "version: 1.0\n"
+        "variables:\n"
+        "  - name: modules\n"
+        "    type: list\n"
+        "    value: [core]\n"
+        "files:\n"
+        "  - path: \"{{}}\"\n"
+        "    each: modules\n"
+        "    as: \"\"\n");
+    EXPECT_THROW(ParserYAML parser(fileName), std::runtime_error);
+}
+
+TEST_F(ParseYAMLTest, MapVariableWithNestedValue_ThrowsWithLocation) {
+    const std::string fileName = writeFile("template.yaml",
+        "version: 1.0\n"
+        "variables:\n"
+        "  - name: settings\n"
+        "    type: map\n"
+        "    value:\n"
+        "      server:\n"
+        "        port: 80\n");
+    try {
+        ParserYAML parser(fileName);
+        FAIL() << "Expected std::runtime_error";
+    } catch (const std::runtime_error& e) {
+        EXPECT_NE(std::string(e.what()).find("for variable at index 0."), std::string::npos) << e.what();
+    }
+}
@@ -0,0 +1,141 @@
+#include <gtest/gtest.h>
+#include "../../src/TemplateBuilder.hpp"
+#include <filesystem>
+#include <fstream>
+#include <sstream>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+using namespace TemplateBuilder;
+
+class TemplateTest : public ::testing::Test {
+protected:
+    const std::string yaml =
+        "version: 1.0\n"
+        "variables:\n"
+        "  - name: name\n"
+        "    type: string\n"
+        "    value: Default\n"
+        "prompts:\n"
+        "  - name: askName\n"
+        "    inputs:\n"
+        "      - variable: name\n"
+        "        input: \"Name: \"\n"
+        "        type: InputString\n"
+        "    result: \"# {{upper(name)}}\"\n"
+        "files:\n"
+        "  - path: README.md\n"
+        "    prompt: askName\n"
+        "  - path: src/{{name}}.txt\n"
+        "    content: \"Hello {{name}}\"\n"
+        "folders:\n"
+        "  - path: docs/\n";
+};
+
+TEST_F(TemplateTest, LoadString_RendersDefaultsToMap) {
+    const Template tmpl = Template::loadString(yaml);
+    const auto files = tmpl.render();
+
+    ASSERT_EQ(files.size(), 2u);
+    EXPECT_EQ(files.at("README.md"), "# DEFAULT");
+    EXPECT_EQ(files.at("src/{{name}}.txt"), "Hello Default");
+    EXPECT_EQ(tmpl.getVariableNames(), std::vector<std::string>{"name"});
+}
+
+TEST_F(TemplateTest, Render_VariablesOverrideDefaultsWithoutMutatingTemplate) {
+    const Template tmpl = Template::loadString(yaml);
+
+    EXPECT_EQ(tmpl.render({{"NAME", "Custom"}}).at("README.md"), "# CUSTOM");
+    EXPECT_EQ(tmpl.render().at("README.md"), "# DEFAULT");
+}
+
+TEST_F(TemplateTest, Render_UnknownVariable_Throws) {
+    const Template tmpl = Template::loadString(yaml);
+    EXPECT_THROW((void)tmpl.render({{"missing", "x"}}), std::invalid_argument);
+}
+
+TEST_F(TemplateTest, Render_ToMemorySink_RecordsFolders) {
+    const Template tmpl = Template::loadString(yaml);
+    MemorySink sink;
+    tmpl.render(sink);
+
+    EXPECT_EQ(sink.getFiles().size(), 2u);
+    EXPECT_EQ(sink.getFolders().count("docs/"), 1u);
+}
+
+TEST_F(TemplateTest, Render_ToDirectorySink_WritesBelowRoot) {
+    const std::filesystem::path root = std::filesystem::temp_directory_path() / "test_Template";
+    std::filesystem::remove_all(root);
+
+    const Template tmpl = Template::loadString(yaml);
+    DirectorySink sink(root);
+    tmpl.render(sink, {{"name", "Disk"}});
+
+    std::ifstream stream(root / "README.md");
+    std::stringstream content;
+    content << stream.rdbuf();
+    EXPECT_EQ(content.str(), "# DISK");
+    EXPECT_TRUE(std::filesystem::is_directory(root / "docs"));
+
+    std::filesystem::remove_all(root);
+}
+
+TEST_F(TemplateTest, Render_ConcurrentRendersOfSameTemplate) {
+    const Template tmpl = Template::loadString(yaml);
+    const int threadCount = 8;
+    std::vector<std::string> results(threadCount);
+    std::vector<std::thread> threads;
+
+    for (int i = 0; i < threadCount; ++i) {
+        threads.emplace_back([&tmpl, &results, i]() {
+            for (int iteration = 0; iteration < 50; ++iteration) {
+                results[i] = tmpl.render({{"name", "n" + std::to_string(i)}}).at("README.md");
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    for (int i = 0; i < threadCount; ++i) {
+        EXPECT_EQ(results[i], "# N" + std::to_string(i));
+    }
+}
+
+TEST_F(TemplateTest, LoadFile_MissingFile_Throws) {
+    EXPECT_THROW((void)Template::loadFile("does-not-exist.yaml"), std::runtime_error);
+}
+
+TEST_F(TemplateTest, Render_ListAndMapOverrides_DriveEach) {
+    const Template tmpl = Template::loadString(
+        "version: 1.0\n"
+        "variables:\n"
+        "  - name: modules\n"
+        "    type: list\n"
+        "    value: [core]\n"
+        "  - name: settings\n"
+        "    type: map\n"
+        "  - name: title\n"
+        "    type: string\n"
+        "files:\n"
+        "  - path: src/{{module}}.txt\n"
+        "    each: modules\n"
+        "    as: module\n"
+        "    content: \"{{title}} {{module}}\"\n"
+        "  - path: conf/{{setting.key}}\n"
+        "    each: settings\n"
+        "    as: setting\n"
+        "    content: \"{{setting.value}}\"\n");
+
+    const auto files = tmpl.render({{"modules", VariableList{"api", "web"}},
+                                    {"settings", VariableMap{{"port", "8080"}}},
+                                    {"title", "Demo"}});
+
+    ASSERT_EQ(files.size(), 3u);
+    EXPECT_EQ(files.at("src/api.txt"), "Demo api");
+    EXPECT_EQ(files.at("src/web.txt"), "Demo web");
+    EXPECT_EQ(files.at("conf/port"), "8080");
+    EXPECT_THROW((void)tmpl.render({{"title", VariableList{"x"}}}), std::invalid_argument);
+    EXPECT_THROW((void)tmpl.render({{"modules", VariableMap{{"a", "b"}}}}), std::invalid_argument);
+}
@@ -0,0 +1,133 @@
+#include <gtest/gtest.h>
+#include "../../src/services/TemplateWatcher.hpp"
+#include <filesystem>
+#include <fstream>
+#include <sstream>
+
+using namespace TemplateBuilder;
+
+class TemplateWatcherTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        originalPath = std::filesystem::current_path();
+        workPath = std::filesystem::temp_directory_path() / "test_TemplateWatcher";
+        std::filesystem::remove_all(workPath);
+        std::filesystem::create_directories(workPath);
+        std::filesystem::current_path(workPath);
+
+        writeFile("body.txt", "Body {{name}}");
+        templatePath = writeFile("template.yaml",
+            "version: 1.0\n"
+            "variables:\n"
+            "  - name: name\n"
+            "    type: string\n"
+            "prompts:\n"
+            "  - name: askName\n"
+            "    inputs:\n"
+            "      - variable: name\n"
+            "        input: \"Name: \"\n"
+            "        type: InputString\n"
+            "    result: \"# {{name}}\"\n"
+            "files:\n"
+            "  - path: out/README.md\n"
+            "    prompt: askName\n"
+            "  - path: out/body.txt\n"
+            "    source: body.txt\n"
+            "  - path: out/static.txt\n"
+            "    content: static\n");
+    }
+
+    void TearDown() override {
+        std::filesystem::current_path(originalPath);
+        std::filesystem::remove_all(workPath);
+    }
+
+    std::filesystem::path writeFile(const std::string& name, const std::string& content) {
+        const std::filesystem::path path = workPath / name;
+        std::ofstream stream(path);
+        stream << content;
+        return path;
+    }
+
+    static std::string readFile(const std::filesystem::path& path) {
+        std::ifstream stream(path);
+        std::stringstream content;
+        content << stream.rdbuf();
+        return content.str();
+    }
+
+    std::filesystem::path originalPath;
+    std::filesystem::path workPath;
+    std::filesystem::path templatePath;
+    std::istringstream input{"Demo\n"};
+    std::ostringstream output;
+};
+
+TEST_F(TemplateWatcherTest, Build_WritesAllOutputs) {
+    TemplateWatcher watcher(templatePath.string(), PromptBuilder(input, output));
+    watcher.build();
+
+    EXPECT_EQ(readFile(workPath / "out/README.md"), "# Demo");
+    EXPECT_EQ(readFile(workPath / "out/body.txt"), "Body Demo");
+    EXPECT_EQ(readFile(workPath / "out/static.txt"), "static");
+    EXPECT_EQ(watcher.getWatchedFiles().size(), 2u);
+}
+
+TEST_F(TemplateWatcherTest, Refresh_SourceChange_RewritesOnlyDependentFile) {
+    TemplateWatcher watcher(templatePath.string(), PromptBuilder(input, output));
+    watcher.build();
+
+    writeFile("body.txt", "Changed {{name}}");
+    EXPECT_EQ(watcher.refresh({workPath / "body.txt"}), 1u);
+    EXPECT_EQ(readFile(workPath / "out/body.txt"), "Changed Demo");
+}
+
+TEST_F(TemplateWatcherTest, Refresh_TemplateChange_KeepsAnswersAndSkipsUnchanged) {
+    TemplateWatcher watcher(templatePath.string(), PromptBuilder(input, output));
+    watcher.build();
+
+    std::string yaml = readFile(templatePath);
+    yaml.replace(yaml.find("content: static"), 15, "content: updated");
+    writeFile("template.yaml", yaml);
+
+    // Only static.txt changed; the prompt is not asked again
+    EXPECT_EQ(watcher.refresh({templatePath}), 1u);
+    EXPECT_EQ(readFile(workPath / "out/static.txt"), "updated");
+    EXPECT_EQ(readFile(workPath / "out/README.md"), "# Demo");
+}
+
+TEST_F(TemplateWatcherTest, Refresh_EachRetargeted_WritesNewOutputs) {
+    templatePath = writeFile("template.yaml",
+        "version: 1.0\n"
+        "variables:\n"
+        "  - name: a\n"
+        "    type: list\n"
+        "    value: [x, y]\n"
+        "  - name: b\n"
+        "    type: list\n"
+        "    value: [p, q]\n"
+        "files:\n"
+        "  - path: \"src/{{item}}.txt\"\n"
+        "    each: a\n"
+        "    content: \"{{item}}\"\n");
+    TemplateWatcher watcher(templatePath.string(), PromptBuilder(input, output));
+    watcher.build();
+    EXPECT_EQ(readFile(workPath / "src/x.txt"), "x");
+
+    std::string yaml = readFile(templatePath);
+    yaml.replace(yaml.find("each: a"), 7, "each: b");
+    writeFile("template.yaml", yaml);
+
+    EXPECT_EQ(watcher.refresh({templatePath}), 2u);
+    EXPECT_EQ(readFile(workPath / "src/p.txt"), "p");
+    EXPECT_EQ(readFile(workPath / "src/q.txt"), "q");
+}
+
+TEST_F(TemplateWatcherTest, Refresh_InvalidTemplate_KeepsPreviousModel) {
+    TemplateWatcher watcher(templatePath.string(), PromptBuilder(input, output));
+    watcher.build();
+
+    writeFile("template.yaml", "version: 9.9\n");
+    EXPECT_THROW(watcher.refresh({templatePath}), UnsupportedTemplateVersion);
+    EXPECT_EQ(watcher.getParser().getFiles().size(), 3u);
+}
@@ -77,3 +77,31 @@ TEST_F(VariableTypeTest, StringToTypeInvalid) {
     EXPECT_THROW(Variable::stringToType("number"), std::invalid_argument);
     EXPECT_THROW(Variable::stringToType(""), std::invalid_argument);
 }
+
+TEST_F(VariableTypeTest, StringToTypeListAndMap) {
+    EXPECT_EQ(Variable::stringToType("list"), VariableType::vtList);
+    EXPECT_EQ(Variable::stringToType("Map"), VariableType::vtMap);
+}
+
+TEST_F(VariableTypeTest, ListValue) {
+    Variable var("modules", VariableType::vtList);
+    var.setList({"core", "net"});
+    EXPECT_TRUE(var.hasValue());
+    EXPECT_TRUE(var.isList());
+    EXPECT_EQ(var.getList().size(), 2u);
+    EXPECT_EQ(var.getText(), "core\nnet\n");
+    EXPECT_THROW((void)var.getValue(), std::runtime_error);
+    EXPECT_THROW((void)var.getMap(), std::runtime_error);
+}
+
+TEST_F(VariableTypeTest, MapValue) {
+    Variable var("ports", VariableType::vtMap);
+    var.setMap({{"http", "80"}, {"https", "443"}});
+    EXPECT_TRUE(var.isMap());
+    EXPECT_EQ(var.getMap()[1].first, "https");
+    EXPECT_EQ(var.getText(), "http: 80\nhttps: 443\n");
+
+    var.clearValue();
+    EXPECT_FALSE(var.hasValue());
+    EXPECT_EQ(var.getText(), "");
+}